@@ -13,7 +13,9 @@
  */
 
 //#define DEBUG // Uncomment for verbose debugging output
+#include <chrono>
 #include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <string>
 
@@ -26,7 +28,9 @@
  * EXIT CODES:
  * 
  * 0: The Qobj was succesfully executed.
- *    Returns full result JSON.
+ *    Returns full result JSON, or the result in the MessagePack or CBOR
+ *    binary encoding if selected by the -f option or the "result_format"
+ *    Qobj config setting.
  * 
  * 1: Command line invalid or Qobj JSON cannot be loaded.
  *    Returns JSON:
@@ -45,6 +49,7 @@
 enum class CmdArguments {
   SHOW_VERSION,
   INPUT_CONFIG,
+  INPUT_FORMAT,
   INPUT_DATA
 };
 
@@ -55,6 +60,9 @@ inline CmdArguments parse_cmd_options(const std::string& argv){
   if (argv == "-c" || argv == "--config")
     return CmdArguments::INPUT_CONFIG;
 
+  if (argv == "-f" || argv == "--format")
+    return CmdArguments::INPUT_FORMAT;
+
   return CmdArguments::INPUT_DATA;
 }
 
@@ -80,18 +88,31 @@ inline void usage(const std::string& command, std::ostream &out){
   show_version();
   std::cerr << "\n";
   std::cerr << "Usage: \n";
-  std::cerr << command << " [-v] [-c <config>] <file>\n";
+  std::cerr << command << " [-v] [-c <config>] [-f <format>] <file>\n";
   std::cerr << "    -v          : Show version\n";
   std::cerr << "    -c <config> : Configuration file\n";;
+  std::cerr << "    -f <format> : Result format: json, msgpack or cbor\n";
   std::cerr << "    file        : qobj file\n";
 }
 
+// Parse the qobj of a file, or of stdin if the name is "stdin" or "-".
+// The config values are added to the qobj config.
+inline AER::Qobj load_qobj(const std::string &name, const json_t &config) {
+  if (name == "stdin" || name == "-")
+    return AER::Qobj::parse(std::cin, config);
+  std::ifstream ifile(name);
+  if (!ifile)
+    throw std::runtime_error(std::string("no such file or directory"));
+  return AER::Qobj::parse(ifile, config);
+}
+
 int main(int argc, char **argv) {
 
   std::ostream &out = std::cout; // output stream
   int indent = 4;
-  json_t qobj;
+  std::string qobj_file;
   json_t config;
+  std::string format;
 
   if(argc == 1){ // NOLINT
     usage(std::string(argv[0]), out); // NOLINT
@@ -118,32 +139,74 @@ int main(int argc, char **argv) {
           return 1;
         }
         break;
-      case CmdArguments::INPUT_DATA:
+      case CmdArguments::INPUT_FORMAT:
+        if (++pos == static_cast<unsigned int>(argc)) {
+          failed("Invalid format (no format is specified.)", out, indent);
+          return 1;
+        }
+        format = std::string(argv[pos]);
         try {
-          qobj = JSON::load(std::string(argv[pos])); // NOLINT
-          pos = argc; //Exit from the loop
-        }catch(std::exception &e){
-          std::string msg = "Invalid input (" +  std::string(e.what()) + ")";
-          failed(msg, out, indent);
+          JSON::check_format(format);
+        } catch (std::exception &e) {
+          failed("Invalid format (" + format + ")", out, indent);
           return 1;
         }
         break;
+      case CmdArguments::INPUT_DATA:
+        qobj_file = std::string(argv[pos]); // NOLINT
+        pos = argc; //Exit from the loop
+        break;
     }
   }
+  if (qobj_file.empty()) {
+    usage(std::string(argv[0]), out); // NOLINT
+    return 1;
+  }
 
-  // Execute simulation
+  // The command line config and result format are added to the qobj
+  // config when the qobj is parsed. The result format is checked before
+  // the qobj is executed.
+  if (!format.empty())
+    config["result_format"] = format;
+  AER::Qobj qobj;
+  format = "json";
+  // The total time taken includes parsing the qobj
+  const auto timer_start = std::chrono::high_resolution_clock::now();
   try {
+    qobj = load_qobj(qobj_file, config);
+    JSON::get_value(format, "result_format", qobj.config);
+    JSON::check_format(format);
+  } catch (std::invalid_argument &e) {
+    // The JSON is valid but the qobj is not
+    AER::Result result;
+    result.status = AER::Result::Status::error;
+    result.message = std::string("Failed to load qobj: ") + e.what();
+    out << result.json().dump(4) << std::endl;
+    return 2;
+  } catch (std::exception &e) {
+    std::string msg = "Invalid input (" +  std::string(e.what()) + ")";
+    failed(msg, out, indent);
+    return 1;
+  }
 
-    // Check for command line config
-    // and if present add to qobj config
-    json_t& config_all = qobj["config"];
-    if (!config.empty()) // NOLINT
-      config_all.update(config.begin(), config.end());
-
+  // Execute simulation
+  try {
     // Initialize simulator
     AER::Simulator::QasmController sim;
     auto result = sim.execute(qobj);
-    out << result.json().dump(4) << std::endl;
+    if (JSON::check_key("time_taken", result.metadata)) {
+      const auto timer_stop = std::chrono::high_resolution_clock::now();
+      result.metadata["time_taken"] =
+          std::chrono::duration<double>(timer_stop - timer_start).count();
+    }
+    if (format == "json") {
+      out << result.json().dump(4) << std::endl;
+    } else {
+      // Binary results are written without a trailing newline
+      const std::string data = JSON::serialize(result.json(), format);
+      out.write(data.data(), data.size());
+      out.flush();
+    }
 
     // Check if execution was successful.
     bool success = false;
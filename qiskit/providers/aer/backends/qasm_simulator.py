@@ -94,7 +94,14 @@ class QasmSimulator(AerBackend):
 
     * ``"automatic"``: The default behavior where the method is chosen
       automatically for each circuit based on the circuit instructions,
-      number of qubits, and noise model.
+      number of qubits, and noise model. Clifford circuits use the
+      stabilizer method. Otherwise the runtime and memory of each method
+      are estimated from the circuit gate counts, the number of
+      multi-qubit gates crossing each cut between neighbouring qubits
+      (which stand in for the circuit depth), noise and shots, and the
+      statevector, density matrix or matrix product state method with the
+      lowest estimated runtime that fits in memory is used. The estimates are returned in the
+      ``"method_estimates"`` field of the result metadata.
 
     **Backend options**
 
@@ -139,6 +146,25 @@ class QasmSimulator(AerBackend):
       values (16 Bytes). If set to 0, the maximum will be automatically
       set to half the system memory size (Default: 0).
 
+    * ``"shot_sink"`` (str): Path of a local file that the per-shot
+      memory, register and snapshot data is streamed to while the
+      simulation runs instead of being returned in the result. Only
+      counts and other aggregate data are kept in memory, and the file is
+      referenced by the ``"shot_sink"`` field of the result metadata.
+      Each record of the file holds the ``"experiment"`` index, the
+      ``"first_shot"`` and number of ``"shots"``, and the per-shot data of
+      a chunk of consecutive shots. Can't be used with
+      ``"checkpoint_directory"`` (Default: "").
+
+    * ``"shot_sink_format"`` (str): Set the shot sink file format to
+      ``"ndjson"`` for a line of JSON per record, or ``"binary"`` for the
+      magic string ``AERSHOT1`` followed by records encoded as CBOR, each
+      preceded by its size as a native byte order uint64
+      (Default: "ndjson").
+
+    * ``"shot_sink_chunk"`` (int): Number of shots written to each record
+      of the shot sink (Default: 1024).
+
     * ``"optimize_ideal_threshold"`` (int): Sets the qubit threshold for
       applying circuit optimization passes on ideal circuits.
       Passes include gate fusion and truncation of unused qubits
@@ -149,6 +175,94 @@ class QasmSimulator(AerBackend):
       Passes include gate fusion and truncation of unused qubits
       (Default: 12).
 
+    * ``"adaptive_shots"`` (bool): Execute shots which cannot use
+      measurement sampling in batches and stop once the standard error
+      of the tracked observable is below ``adaptive_shots_target_error``.
+      The number of executed shots is returned in the
+      ``"adaptive_shots"`` field of the result metadata (Default: False).
+
+    * ``"adaptive_shots_target_error"`` (double): Target standard error
+      for adaptive shot execution (Default: 0.01).
+
+    * ``"adaptive_shots_batch_size"`` (int): Number of shots executed
+      between adaptive shot convergence checks. The shots of a batch are
+      executed in parallel unless checkpointing is enabled (Default: 100).
+
+    * ``"adaptive_shots_min_shots"`` (int): Minimum number of shots
+      executed before adaptive shot execution may stop (Default: 1000).
+
+    * ``"adaptive_shots_observable"`` (str): Set the data used for the
+      adaptive shot convergence check to either ``"counts"`` or
+      ``"expectation_value"``. The latter requires expectation value
+      snapshots that compute the variance (Default: "counts").
+
+    * ``"checkpoint_directory"`` (str): Existing directory in which
+      checkpoints of running experiments are periodically saved. If a
+      checkpoint for an experiment is found execution is resumed from it.
+      Resuming requires running the same Qobj with the same
+      ``seed_simulator`` and parallelization options. Checkpoints are
+      removed once an experiment completes. If empty checkpointing is
+      disabled (Default: "").
+
+    * ``"checkpoint_period"`` (double): Number of seconds between
+      checkpoints of a running experiment (Default: 600).
+
+    * ``"noise_streaming"`` (bool): Simulate noisy shots of the
+      ``"statevector"`` method by applying the sampled errors of each
+      instruction directly to the state, instead of sampling a noisy
+      circuit for each shot. Not used for circuits that are changed by
+      the circuit optimizations of noisy shots, such as fusion
+      (Default: True).
+
+    * ``"batched_shots"`` (int): Number of noisy shots simulated together
+      as a batch by the ``"statevector"`` method. Gates are applied to
+      every shot of a batch at once, and sampled Pauli and unitary errors
+      to single shots of the batch. Batching is an opt-in option that
+      currently gives a speedup of less than 2x for noisy circuits of 5 to
+      12 qubits, so it is not enabled automatically. Values less than 2
+      disable batching (Default: 1).
+
+    * ``"batched_shots_threshold"`` (int): Sets the threshold that the
+      number of qubits must be less than or equal to for noisy shots to
+      be simulated in batches (Default: 12).
+
+    * ``"sparse_noise_threshold"`` (double): Maximum expected number of
+      non-identity errors per shot for sampling the errors of all shots
+      before execution. Shots with the same errors are executed once, and
+      shots without errors may use measurement sampling. Not used for
+      circuits containing snapshots. Set to 0 to disable (Default: 4).
+
+    * ``"sparse_noise_cache_mb"`` (int): Memory in MB for caching
+      statevectors of the ``"statevector"`` method during sparse noise
+      sampling. For circuits that can use measurement sampling, each
+      pattern of errors resumes from a cached statevector of the errors it
+      shares with previous patterns. Set to 0 to disable (Default: 256).
+
+    * ``"pauli_frame_simulation"`` (bool): Simulate noisy shots of the
+      ``"stabilizer"`` method by propagating the Pauli frame of each shot
+      relative to a single reference shot of the ideal circuit. This is
+      used for circuits without conditionals or snapshots when every
+      quantum error is a mixture of Pauli gates (Default: True).
+
+    * ``"probabilities_with_readout"`` (bool): For circuits that can use
+      measurement sampling and only return counts, return the exact
+      probabilities of the measurement outcomes after readout errors as
+      ``"probabilities_with_readout"`` data, and sample the counts from
+      them. This is used by the ``"statevector"`` and
+      ``"density_matrix"`` methods when every readout error acts on
+      measured memory bits (Default: False).
+
+    * ``"probabilities_with_readout_threshold"`` (int): Maximum number of
+      measured qubits for returning ``"probabilities_with_readout"``.
+      Larger circuits sample the outcome of each shot instead
+      (Default: 20).
+
+    * ``"packed_memory"`` (bool): If the per-shot memory is returned, return
+      it as a 2-D ``uint8`` numpy array with a row for each shot instead of
+      a list of hex strings. Bit ``j`` of the memory of a shot is bit
+      ``j % 8`` of byte ``j // 8`` of its row. This only applies to results
+      returned through the Python bindings (Default: False).
+
     These backend options only apply when using the ``"statevector"``
     simulation method:
 
@@ -1,3 +1,4 @@
+#include <chrono>
 #include <iostream>
 
 #include <pybind11/pybind11.h>
@@ -11,18 +12,65 @@
 #include "controllers/unitary_controller.hpp"
 #include "controllers/controller_execute.hpp"
 
+namespace AER {
+
+// Execute a qobj given as python objects. The instructions and noise model
+// are converted directly to ops, so numpy matrix params are copied straight
+// into matrices without converting the qobj to JSON.
+template <class controller_t>
+Result controller_execute(const py::handle &qobj_py) {
+  controller_t controller;
+  Noise::NoiseModel noise_model;
+  Qobj qobj;
+  // Start QOBJ timer
+  auto timer_start = std::chrono::high_resolution_clock::now();
+  try {
+    qobj = PyToAer::to_qobj(qobj_py, noise_model);
+  } catch (std::exception &e) {
+    // qobj was invalid, return valid output containing error message
+    Result result;
+    result.status = Result::Status::error;
+    result.message = std::string("Failed to load qobj: ") + e.what();
+    return result;
+  }
+
+  // Fix for MacOS and OpenMP library double initialization crash.
+  // Issue: https://github.com/Qiskit/qiskit-aer/issues/1
+  if (qobj.config.is_object()) {
+    std::string path;
+    JSON::get_value(path, "library_dir", qobj.config);
+    Hacks::maybe_load_openmp(path);
+  }
+
+  auto result = controller.execute(qobj, noise_model);
+  // Stop the timer and add total timing data including qobj conversion
+  if (JSON::check_key("time_taken", result.metadata)) {
+    auto timer_stop = std::chrono::high_resolution_clock::now();
+    result.metadata["time_taken"] = std::chrono::duration<double>(timer_stop - timer_start).count();
+  }
+  return result;
+}
+
+} // end namespace AER
+
 PYBIND11_MODULE(controller_wrappers, m) {
-    m.def("qasm_controller_execute_json", &AER::controller_execute_json<AER::Simulator::QasmController>, "instance of controller_execute for QasmController");
+    m.def("qasm_controller_execute_json", [](const std::string &qobj) -> py::object {
+        return AerToPy::from_serialized(AER::controller_execute_json<AER::Simulator::QasmController>(qobj));
+    }, "instance of controller_execute for QasmController");
     m.def("qasm_controller_execute", [](const py::object &qobj) -> py::object {
         return AerToPy::from_result(AER::controller_execute<AER::Simulator::QasmController>(qobj));
     });
 
-    m.def("statevector_controller_execute_json", &AER::controller_execute_json<AER::Simulator::StatevectorController>, "instance of controller_execute for StatevectorController");
+    m.def("statevector_controller_execute_json", [](const std::string &qobj) -> py::object {
+        return AerToPy::from_serialized(AER::controller_execute_json<AER::Simulator::StatevectorController>(qobj));
+    }, "instance of controller_execute for StatevectorController");
     m.def("statevector_controller_execute", [](const py::object &qobj) -> py::object {
         return AerToPy::from_result(AER::controller_execute<AER::Simulator::StatevectorController>(qobj));
     });
 
-    m.def("unitary_controller_execute_json", &AER::controller_execute_json<AER::Simulator::UnitaryController>, "instance of controller_execute for UnitaryController");
+    m.def("unitary_controller_execute_json", [](const std::string &qobj) -> py::object {
+        return AerToPy::from_serialized(AER::controller_execute_json<AER::Simulator::UnitaryController>(qobj));
+    }, "instance of controller_execute for UnitaryController");
     m.def("unitary_controller_execute", [](const py::object &qobj) -> py::object {
         return AerToPy::from_result(AER::controller_execute<AER::Simulator::UnitaryController>(qobj));
     });
@@ -16,6 +16,7 @@ Helper functions for noise model creation.
 import numpy as np
 
 from qiskit.quantum_info.operators.operator import Operator
+from qiskit.quantum_info.operators.channel.choi import Choi
 from qiskit.quantum_info.operators.channel.kraus import Kraus
 from qiskit.quantum_info.operators.channel.superop import SuperOp
 from qiskit.quantum_info.operators.predicates import is_identity_matrix
@@ -339,6 +340,19 @@ def reset_superop(num_qubits):
     return reset_n
 
 
+def thermal_relaxation_superop(t1, t2, time, excited_state_population=0):
+    """Return the SuperOp for a single-qubit thermal relaxation channel."""
+    p_reset = 1 - np.exp(-time / t1)
+    exp_t2 = np.exp(-time / t2)
+    p0 = 1 - excited_state_population
+    p1 = excited_state_population
+    return SuperOp(
+        Choi(
+            np.array([[1 - p1 * p_reset, 0, 0, exp_t2],
+                      [0, p1 * p_reset, 0, 0], [0, 0, p0 * p_reset, 0],
+                      [exp_t2, 0, 0, 1 - p0 * p_reset]])))
+
+
 def standard_instruction_operator(instr):
     """Return the Operator for a standard gate instruction."""
     # Convert to dict (for QobjInstruction types)
@@ -403,6 +417,9 @@ def standard_instruction_channel(instr):
     if name == 'kraus':
         params = instr['params']
         return SuperOp(Kraus(params))
+    # Check if thermal relaxation instruction
+    if name == 'thermal_relaxation':
+        return thermal_relaxation_superop(*instr['params'])
     return None
 
 
@@ -260,7 +260,11 @@ class QuantumError:
         return channel
 
     def to_instruction(self):
-        """Convert the QuantumError to a circuit Instruction."""
+        """Convert the QuantumError to a circuit Instruction.
+
+        Native noise instructions, such as ``thermal_relaxation``, are
+        converted to their Kraus channel.
+        """
         return self.to_quantumchannel().to_instruction()
 
     def error_term(self, position):
@@ -399,8 +399,12 @@ def thermal_relaxation_error(t1, t2, time, excited_state_population=0):
         * If :math:`T_2 \le T_1` the error can be expressed as a mixed
           reset and unitary error channel.
 
-        * If :math:`T_1 < T_2 \le 2 T_1` the error must be expressed as a
-          general non-unitary Kraus error channel.
+        * If :math:`T_1 < T_2 \le 2 T_1` the error is expressed as a single
+          native ``thermal_relaxation`` instruction with parameters
+          ``[t1, t2, time, excited_state_population]``. The simulator applies
+          it directly rather than as a general Kraus channel, and
+          :meth:`QuantumError.to_instruction` converts it to the equivalent
+          Kraus channel.
     """
     if excited_state_population < 0:
         raise NoiseError("Invalid excited state population "
@@ -428,22 +432,23 @@ def thermal_relaxation_error(t1, t2, time, excited_state_population=0):
     # T2 dephasing rate
     if t2 == np.inf:
         rate2 = 0
-        exp_t2 = 1
     else:
         rate2 = 1 / t2
-        exp_t2 = np.exp(-time * rate2)
     # Qubit state equilibrium probabilities
     p0 = 1 - excited_state_population
     p1 = excited_state_population
 
     if t2 > t1:
-        # If T_2 > T_1 we must express this as a Kraus channel
-        # We start with the Choi-matrix representation:
-        chan = Choi(
-            np.array([[1 - p1 * p_reset, 0, 0, exp_t2],
-                      [0, p1 * p_reset, 0, 0], [0, 0, p0 * p_reset, 0],
-                      [exp_t2, 0, 0, 1 - p0 * p_reset]]))
-        return QuantumError(Kraus(chan))
+        # If T_2 > T_1 the channel is not a mixture of unitary and reset
+        # errors, so we use the native thermal relaxation instruction
+        if time == 0:
+            return QuantumError([([{'name': 'id', 'qubits': [0]}], 1)])
+        instruction = {
+            'name': 'thermal_relaxation',
+            'qubits': [0],
+            'params': [t1, t2, time, excited_state_population]
+        }
+        return QuantumError([([instruction], 1)])
     else:
         # If T_2 < T_1 we can express this channel as a probabilistic
         # mixture of reset operations and unitary errors:
@@ -17,6 +17,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <exception>
 #include <iostream>
 #include <random>
 #include <sstream>
@@ -90,13 +91,28 @@ namespace Base {
  * - "max_memory_mb" (int): Sets the maximum size of memory for a store.
  *      If a state needs more, an error is thrown. If set to 0, the maximum
  *      will be automatically set to the system memory size [Default: 0].
+ * - "shot_sink" (str): Path of a file that the per-shot memory, register
+ *      and snapshot data of all experiments is streamed to instead of
+ *      being returned in the result. Each record of the file holds the
+ *      per-shot data of a chunk of consecutive shots of an experiment. The
+ *      result metadata references the file. If empty per-shot data is
+ *      returned in the result [Default: ""].
+ * - "shot_sink_format" (str): Format of the shot sink file, "ndjson" for a
+ *      line of JSON per record or "binary" for size prefixed CBOR records
+ *      [Default: "ndjson"].
  *
  * Config settings from Data class:
  *
  * - "counts" (bool): Return counts objecy in circuit data [Default: True]
  * - "snapshots" (bool): Return snapshots object in circuit data [Default: True]
  * - "memory" (bool): Return memory array in circuit data [Default: False]
+ * - "packed_memory" (bool): Return the memory array to Python as a 2-d
+ *                           uint8 numpy array with a row of packed bytes for
+ *                           each shot instead of a list of hex strings.
+ *                           [Default: False]
  * - "register" (bool): Return register array in circuit data [Default: False]
+ * - "shot_sink_chunk" (int): Number of shots of per-shot data written to
+ *                            each record of a shot sink [Default: 1024]
  * - "noise_model" (json): A noise model JSON dictionary for the simulator.
  *                         [Default: null]
  **************************************************************************/
@@ -114,6 +130,13 @@ public:
   // class.
   virtual Result execute(const json_t &qobj);
 
+  // Execute a loaded QOBJ
+  virtual Result execute(Qobj &qobj);
+
+  // Execute a loaded QOBJ with a noise model loaded separately from it.
+  // Any "noise_model" in the QOBJ config is ignored.
+  virtual Result execute(Qobj &qobj, const Noise::NoiseModel &noise_model);
+
   virtual Result execute(std::vector<Circuit> &circuits,
                          const Noise::NoiseModel &noise_model,
                          const json_t &config);
@@ -144,10 +167,28 @@ protected:
 
   // Parallel execution of a circuit
   // This function manages parallel shot configuration and internally calls
-  // the `run_circuit` method for each shot thread
+  // the `run_circuit` method for each shot thread.
+  // The experiment index locates the per-shot data in the shot sink.
   virtual ExperimentResult execute_circuit(Circuit &circ,
                                            Noise::NoiseModel &noise,
-                                           const json_t &config);
+                                           const json_t &config,
+                                           uint_t experiment);
+
+  // Execute all shots of a circuit and return the combined output data.
+  // By default all shots are executed by `run_shot_threads`.
+  virtual ExperimentData execute_shots(const Circuit &circ,
+                                       const Noise::NoiseModel &noise,
+                                       const json_t &config,
+                                       uint_t experiment) const;
+
+  // Execute shots of a circuit split between the shot threads, the first
+  // of which uses the input rng seed, and combine their output data.
+  // The per-shot data of the shot sink is numbered from first_shot.
+  ExperimentData run_shot_threads(const Circuit &circ,
+                                  const Noise::NoiseModel &noise,
+                                  const json_t &config, uint_t experiment,
+                                  uint_t shots, uint_t rng_seed,
+                                  uint_t first_shot) const;
 
   // Abstract method for executing a circuit.
   // This method must initialize a state and return output data for
@@ -244,6 +285,22 @@ protected:
 
   // Truncate qubits
   bool truncate_qubits_ = true;
+
+  //-----------------------------------------------------------------------
+  // Shot sink
+  //-----------------------------------------------------------------------
+
+  // Return a copy of the config of a shot thread that tags its per-shot
+  // data in the shot sink with the experiment index and its first shot
+  static json_t shot_sink_config(const json_t &config, uint_t experiment,
+                                 uint_t first_shot);
+
+  std::string shot_sink_path_;
+  std::string shot_sink_format_ = "ndjson";
+
+  // Sink of the per-shot data of the executing QOBJ, which is null if
+  // per-shot data is returned in the result
+  std::shared_ptr<ShotSink> shot_sink_;
 };
 
 
@@ -263,6 +320,10 @@ void Controller::set_config(const json_t &config) {
   // Load qubit truncation
   JSON::get_value(truncate_qubits_, "truncate_enable", config);
 
+  // Load shot sink
+  JSON::get_value(shot_sink_path_, "shot_sink", config);
+  JSON::get_value(shot_sink_format_, "shot_sink_format", config);
+
   #ifdef _OPENMP
   // Load OpenMP maximum thread settings
   if (JSON::check_key("max_parallel_threads", config))
@@ -320,6 +381,16 @@ void Controller::set_config(const json_t &config) {
 void Controller::clear_config() {
   clear_parallelization();
   validation_threshold_ = 1e-8;
+  shot_sink_path_.clear();
+  shot_sink_format_ = "ndjson";
+}
+
+json_t Controller::shot_sink_config(const json_t &config, uint_t experiment,
+                                    uint_t first_shot) {
+  json_t part_config = config;
+  part_config["_shot_sink_experiment"] = experiment;
+  part_config["_shot_sink_first_shot"] = first_shot;
+  return part_config;
 }
 
 void Controller::clear_parallelization() {
@@ -350,9 +421,23 @@ void Controller::set_parallelization_experiments(const std::vector<Circuit>& cir
   }
 
   // If memory allows, execute experiments in parallel
-  std::vector<size_t> required_memory_mb_list(circuits.size());
-  for (size_t j=0; j<circuits.size(); j++) {
-    required_memory_mb_list[j] = required_memory_mb(circuits[j], noise);
+  // The required memory depends on the simulation method chosen for each
+  // circuit, so the circuits are checked in parallel. Exceptions can't
+  // leave a parallel region, so the first error is rethrown afterwards.
+  const int_t num_circuits = circuits.size();
+  std::vector<size_t> required_memory_mb_list(num_circuits);
+  std::vector<std::exception_ptr> errors(num_circuits);
+  #pragma omp parallel for if (num_circuits > 1) num_threads(max_parallel_threads_)
+  for (int_t j = 0; j < num_circuits; j++) {
+    try {
+      required_memory_mb_list[j] = required_memory_mb(circuits[j], noise);
+    } catch (...) {
+      errors[j] = std::current_exception();
+    }
+  }
+  for (const auto &error : errors) {
+    if (error)
+      std::rethrow_exception(error);
   }
   std::sort(required_memory_mb_list.begin(), required_memory_mb_list.end(), std::greater<>());
   size_t total_memory = 0;
@@ -502,29 +587,59 @@ void Controller::optimize_circuit(Circuit &circ,
 Result Controller::execute(const json_t &qobj_js) {
   // Load QOBJ in a try block so we can catch parsing errors and still return
   // a valid JSON output containing the error message.
+  Qobj qobj;
+  // Start QOBJ timer
+  auto timer_start = myclock_t::now();
   try {
-    // Start QOBJ timer
-    auto timer_start = myclock_t::now();
+    qobj = Qobj(qobj_js);
+  } catch (std::exception &e) {
+    // qobj was invalid, return valid output containing error message
+    Result result;
+    result.status = Result::Status::error;
+    result.message = std::string("Failed to load qobj: ") + e.what();
+    return result;
+  }
+  auto result = execute(qobj);
+  // Stop the timer and add total timing data including qobj parsing
+  if (JSON::check_key("time_taken", result.metadata)) {
+    auto timer_stop = myclock_t::now();
+    result.metadata["time_taken"] = std::chrono::duration<double>(timer_stop - timer_start).count();
+  }
+  return result;
+}
 
-    Qobj qobj(qobj_js);
-    Noise::NoiseModel noise_model;
-    json_t config;
+Result Controller::execute(Qobj &qobj) {
+  // Load the noise model in a try block so we can catch errors and still
+  // return a valid JSON output containing the error message.
+  Noise::NoiseModel noise_model;
+  try {
+    if (qobj.config.is_object()) {
+      JSON::get_value(noise_model, "noise_model", qobj.config);
+    }
+  } catch (std::exception &e) {
+    Result result;
+    result.status = Result::Status::error;
+    result.message = std::string("Failed to load qobj: ") + e.what();
+    return result;
+  }
+  return execute(qobj, noise_model);
+}
+
+Result Controller::execute(Qobj &qobj, const Noise::NoiseModel &noise_model) {
+  // Load the config in a try block so we can catch errors and still return
+  // a valid JSON output containing the error message.
+  try {
     // Check for config
-    if (JSON::get_value(config, "config", qobj_js)) {
+    if (qobj.config.is_object()) {
       // Set config
-      set_config(config);
-      // Load noise model
-      JSON::get_value(noise_model, "noise_model", config);
+      set_config(qobj.config);
     }
-    auto result = execute(qobj.circuits, noise_model, config);
+    auto result = execute(qobj.circuits, noise_model, qobj.config);
     // Get QOBJ id and pass through header to result
     result.qobj_id = qobj.id;
     if (!qobj.header.empty()) {
         result.header = qobj.header;
     }
-    // Stop the timer and add total timing data including qobj parsing
-    auto timer_stop = myclock_t::now();
-    result.metadata["time_taken"] = std::chrono::duration<double>(timer_stop - timer_start).count();
     return result;
   } catch (std::exception &e) {
     // qobj was invalid, return valid output containing error message
@@ -563,7 +678,10 @@ Result Controller::execute(std::vector<Circuit> &circuits,
   #endif
     result.metadata["parallel_experiments"] = parallel_experiments_;
     result.metadata["max_memory_mb"] = max_memory_mb_;
-    
+
+    // Open the shot sink that per-shot data is streamed to
+    if (!shot_sink_path_.empty())
+      shot_sink_ = std::make_shared<ShotSink>(shot_sink_path_, shot_sink_format_);
 
   #ifdef _OPENMP
     if (parallel_shots_ > 1 || parallel_state_update_ > 1)
@@ -578,7 +696,7 @@ Result Controller::execute(std::vector<Circuit> &circuits,
         auto circ_noise_model = noise_model;
         result.results[j] = execute_circuit(circuits[j],
                                             circ_noise_model,
-                                            config);
+                                            config, j);
       }
     } else {
       // Serial circuit execution
@@ -587,10 +705,21 @@ Result Controller::execute(std::vector<Circuit> &circuits,
         auto circ_noise_model = noise_model;
         result.results[j] = execute_circuit(circuits[j],
                                             circ_noise_model,
-                                            config);
+                                            config, j);
       }
     }
 
+    // Write the remaining records of the shot sink and reference its file
+    if (shot_sink_) {
+      shot_sink_->close();
+      json_t sink;
+      sink["path"] = shot_sink_->path();
+      sink["format"] = shot_sink_->format();
+      sink["records"] = shot_sink_->records();
+      result.metadata["shot_sink"] = sink;
+      shot_sink_.reset();
+    }
+
     // Check each experiment result for completed status.
     // If only some experiments completed return partial completed status.
     result.status = Result::Status::completed;
@@ -608,6 +737,7 @@ Result Controller::execute(std::vector<Circuit> &circuits,
   catch (std::exception &e) {
     result.status = Result::Status::error;
     result.message = e.what();
+    shot_sink_.reset();
   }
   return result;
 }
@@ -615,7 +745,8 @@ Result Controller::execute(std::vector<Circuit> &circuits,
 
 ExperimentResult Controller::execute_circuit(Circuit &circ,
                                              Noise::NoiseModel& noise,
-                                             const json_t &config) {
+                                             const json_t &config,
+                                             uint_t experiment) {
 
   // Start individual circuit timer
   auto timer_start = myclock_t::now(); // state circuit timer
@@ -638,44 +769,7 @@ ExperimentResult Controller::execute_circuit(Circuit &circ,
     if (!explicit_parallelization_) {
       set_parallelization_circuit(circ, noise);
     }
-    // Single shot thread execution
-    if (parallel_shots_ <= 1) {
-      auto tmp_data = run_circuit(circ, noise, config, circ.shots, circ.seed);
-      data.combine(std::move(tmp_data));
-    // Parallel shot thread execution
-    } else {
-      // Calculate shots per thread
-      std::vector<unsigned int> subshots;
-      for (int j = 0; j < parallel_shots_; ++j) {
-        subshots.push_back(circ.shots / parallel_shots_);
-      }
-      // If shots is not perfectly divisible by threads, assign the remainder
-      for (int j=0; j < int(circ.shots % parallel_shots_); ++j) {
-        subshots[j] += 1;
-      }
-
-      // Vector to store parallel thread output data
-      std::vector<ExperimentData> par_data(parallel_shots_);
-      std::vector<std::string> error_msgs(parallel_shots_);
-      #pragma omp parallel for if (parallel_shots_ > 1) num_threads(parallel_shots_)
-      for (int i = 0; i < parallel_shots_; i++) {
-        try {
-          par_data[i] = run_circuit(circ, noise, config, subshots[i], circ.seed + i);
-        } catch (std::runtime_error &error) {
-          error_msgs[i] = error.what();
-        }
-      }
-
-      for (std::string error_msg: error_msgs)
-        if (error_msg != "")
-          throw std::runtime_error(error_msg);
-
-      // Accumulate results across shots
-      // Use move semantics to avoid copying data
-      for (auto &datum : par_data) {
-        data.combine(std::move(datum));
-      }
-    }
+    data.combine(execute_shots(circ, noise, config, experiment));
     // Report success
     exp_result.data = data;
     exp_result.status = ExperimentResult::Status::completed;
@@ -706,6 +800,79 @@ ExperimentResult Controller::execute_circuit(Circuit &circ,
   return exp_result;
 }
 
+ExperimentData Controller::execute_shots(const Circuit &circ,
+                                        const Noise::NoiseModel &noise,
+                                        const json_t &config,
+                                        uint_t experiment) const {
+  return run_shot_threads(circ, noise, config, experiment, circ.shots,
+                          circ.seed, 0);
+}
+
+ExperimentData Controller::run_shot_threads(const Circuit &circ,
+                                            const Noise::NoiseModel &noise,
+                                            const json_t &config,
+                                            uint_t experiment, uint_t shots,
+                                            uint_t rng_seed,
+                                            uint_t first_shot) const {
+  // Single shot thread execution
+  const int num_threads = std::min<int>(parallel_shots_, shots);
+  if (num_threads <= 1) {
+    return (shot_sink_)
+      ? run_circuit(circ, noise, shot_sink_config(config, experiment, first_shot),
+                    shots, rng_seed)
+      : run_circuit(circ, noise, config, shots, rng_seed);
+  }
+  // Parallel shot thread execution
+  // Calculate shots per thread
+  std::vector<unsigned int> subshots;
+  for (int j = 0; j < num_threads; ++j) {
+    subshots.push_back(shots / num_threads);
+  }
+  // If shots is not perfectly divisible by threads, assign the remainder
+  for (int j=0; j < int(shots % num_threads); ++j) {
+    subshots[j] += 1;
+  }
+  // First shot of each thread in the shot sink
+  std::vector<uint_t> first_shots(num_threads, first_shot);
+  for (int j = 1; j < num_threads; ++j) {
+    first_shots[j] = first_shots[j - 1] + subshots[j - 1];
+  }
+
+  // Vector to store parallel thread output data
+  std::vector<ExperimentData> par_data(num_threads);
+  std::vector<std::string> error_msgs(num_threads);
+  #pragma omp parallel for if (num_threads > 1) num_threads(num_threads)
+  for (int i = 0; i < num_threads; i++) {
+    try {
+      par_data[i] = (shot_sink_)
+        ? run_circuit(circ, noise,
+                      shot_sink_config(config, experiment, first_shots[i]),
+                      subshots[i], rng_seed + i)
+        : run_circuit(circ, noise, config, subshots[i], rng_seed + i);
+    } catch (std::runtime_error &error) {
+      error_msgs[i] = error.what();
+    }
+  }
+
+  for (std::string error_msg: error_msgs)
+    if (error_msg != "")
+      throw std::runtime_error(error_msg);
+
+  // Accumulate results across shots as a binary tree so that
+  // independent pairs are combined in parallel. Pairs are combined
+  // in order so the pershot data remains ordered by thread.
+  // Use move semantics to avoid copying data
+  for (int step = 1; step < num_threads; step *= 2) {
+    const int num_pairs = (num_threads + step - 1) / (2 * step);
+    #pragma omp parallel for if (num_pairs > 1) num_threads(std::min(num_pairs, num_threads))
+    for (int j = 0; j < num_pairs; j++) {
+      const int i = 2 * step * j;
+      par_data[i].combine(std::move(par_data[i + step]));
+    }
+  }
+  return std::move(par_data[0]);
+}
+
 //-------------------------------------------------------------------------
 } // end namespace Base
 //-------------------------------------------------------------------------
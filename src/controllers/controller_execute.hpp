@@ -15,9 +15,11 @@
 #ifndef _aer_controller_execute_hpp_
 #define _aer_controller_execute_hpp_
 
+#include <chrono>
 #include <string>
 #include "framework/json.hpp"
 #include "misc/hacks.hpp"
+#include "framework/qobj.hpp"
 #include "framework/results/result.hpp"
 
 //=========================================================================
@@ -25,22 +27,47 @@
 //=========================================================================
 
 // This is used to make wrapping Controller classes in Cython easier
-// by handling the parsing of std::string input into JSON objects.
+// by handling the parsing of std::string input into a Qobj. The
+// experiments are converted to circuits while the string is parsed.
+// The result is serialized in the format of the "result_format" config
+// setting: "json" (default), "msgpack" or "cbor".
 namespace AER { 
 template <class controller_t>
 std::string controller_execute_json(const std::string &qobj_str) {
   controller_t controller;
-  auto qobj_js = json_t::parse(qobj_str);
+  Qobj qobj;
+  std::string format = "json";
+  // The total time taken includes parsing the qobj
+  const auto timer_start = std::chrono::high_resolution_clock::now();
+  try {
+    qobj = Qobj::parse(qobj_str);
+    // The result format is checked before the qobj is executed
+    if (qobj.config.is_object())
+      JSON::get_value(format, "result_format", qobj.config);
+    JSON::check_format(format);
+  } catch (std::exception &e) {
+    // qobj was invalid, return valid output containing error message
+    Result result;
+    result.status = Result::Status::error;
+    result.message = std::string("Failed to load qobj: ") + e.what();
+    return result.json().dump();
+  }
 
-  // Fix for MacOS and OpenMP library double initialization crash.
-  // Issue: https://github.com/Qiskit/qiskit-aer/issues/1
-  if (JSON::check_key("config", qobj_js)) {
+  if (qobj.config.is_object()) {
+    // Fix for MacOS and OpenMP library double initialization crash.
+    // Issue: https://github.com/Qiskit/qiskit-aer/issues/1
     std::string path;
-    JSON::get_value(path, "library_dir", qobj_js["config"]);
+    JSON::get_value(path, "library_dir", qobj.config);
     Hacks::maybe_load_openmp(path);
   }
 
-  return controller.execute(qobj_js).json().dump(-1);
+  auto result = controller.execute(qobj);
+  if (JSON::check_key("time_taken", result.metadata)) {
+    const auto timer_stop = std::chrono::high_resolution_clock::now();
+    result.metadata["time_taken"] =
+        std::chrono::duration<double>(timer_stop - timer_start).count();
+  }
+  return JSON::serialize(result.json(), format);
 }
 
 template <class controller_t>
@@ -0,0 +1,275 @@
+/**
+ * This code is part of Qiskit.
+ *
+ * (C) Copyright IBM 2018, 2019.
+ *
+ * This code is licensed under the Apache License, Version 2.0. You may
+ * obtain a copy of this license in the LICENSE.txt file in the root directory
+ * of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Any modifications or derivative works of this code must retain this
+ * copyright notice, and modified files need to carry a notice indicating
+ * that they have been altered from the originals.
+ */
+
+#ifndef _aer_controllers_cost_model_hpp_
+#define _aer_controllers_cost_model_hpp_
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "framework/circuit.hpp"
+#include "framework/types.hpp"
+
+namespace AER {
+namespace Simulator {
+
+//=========================================================================
+// Circuit features used for estimating simulation cost
+//=========================================================================
+
+struct CircuitFeatures {
+  uint_t num_qubits = 0;
+  uint_t shots = 1;
+
+  // Number of measure instructions
+  uint_t num_measure = 0;
+
+  // Number of gate, matrix and noise instructions outside the Clifford group
+  uint_t num_non_clifford = 0;
+
+  // Number of gate, matrix and noise instructions acting on k-qubits,
+  // indexed by k
+  std::vector<uint_t> op_widths;
+
+  // Number of multi-qubit instructions acting across the cut between
+  // qubits k and k + 1, indexed by k
+  std::vector<uint_t> cut_crossings;
+
+  // True if the noise model contains quantum errors
+  bool noise = false;
+
+  // True if the measure sampling optimization can be used by the method
+  // the features are being estimated for
+  bool measure_sampling = false;
+};
+
+// Extract the qubit, gate and locality features of a circuit.
+// The circuit depth is not a feature: the runtime of every method scales
+// with the number of instructions rather than the number of layers, and
+// the entanglement that limits the matrix product state method is bounded
+// by the instructions crossing each cut, so op counts and cut crossings
+// stand in for depth.
+// The noise and measure sampling features depend on the noise model
+// and simulation method and must be set by the caller.
+CircuitFeatures circuit_features(const Circuit &circ);
+
+//=========================================================================
+// Cost model interface
+//=========================================================================
+
+struct CostEstimate {
+  // Relative runtime in units of a single amplitude update
+  double runtime = 0;
+  // Required memory in MB
+  double memory_mb = 0;
+};
+
+class CostModel {
+public:
+  virtual ~CostModel() = default;
+
+  // Return the estimated runtime and memory for simulating a circuit with
+  // the input features using the named simulation method
+  virtual CostEstimate estimate(const std::string &method,
+                                const CircuitFeatures &features) const = 0;
+};
+
+//=========================================================================
+// Default cost model
+//=========================================================================
+
+// Estimates are based on the scaling of each method:
+// - statevector: a k-qubit instruction updates 2^(n + k) amplitudes
+// - density_matrix: a k-qubit instruction updates 4^(n + k) amplitudes,
+//   but noise is applied as a single superoperator circuit
+// - stabilizer: O(n) per Clifford instruction and O(n^2) per measure
+// - matrix_product_state: O(chi^3) per multi-qubit instruction for each
+//   cut it crosses, where the bond dimension chi at each cut is bounded
+//   by the number of multi-qubit instructions crossing the cut
+// - extended_stabilizer: O(n chi) per instruction where chi grows
+//   exponentially with the number of non-Clifford instructions
+// If measure sampling can not be used the estimate is multiplied by
+// the number of shots.
+class DefaultCostModel : public CostModel {
+public:
+  virtual CostEstimate estimate(const std::string &method,
+                                const CircuitFeatures &features) const override;
+
+protected:
+  // Fixed overhead of a matrix product state instruction from tensor
+  // allocation and decomposition
+  double mps_op_overhead_ = 16384.;
+
+  // Stabilizer extent of a T gate and the default approximation error
+  // of the extended stabilizer method
+  double extended_stabilizer_extent_ = 1.1716;
+  double extended_stabilizer_delta_ = 0.05;
+  double extended_stabilizer_mixing_time_ = 5000.;
+
+  // Upper bound on the log2 bond dimension or stabilizer rank used in
+  // estimates. Larger values already exceed the memory of any system, and
+  // clamping them keeps the estimates finite.
+  double max_log2_chi_ = 64.;
+};
+
+//=========================================================================
+// Implementations
+//=========================================================================
+
+CircuitFeatures circuit_features(const Circuit &circ) {
+  static const stringset_t clifford_gates({"CX", "cx", "cz", "swap", "id",
+                                           "x", "y", "z", "h", "s", "sdg"});
+  CircuitFeatures features;
+  features.num_qubits = circ.num_qubits;
+  features.shots = circ.shots;
+  features.cut_crossings.assign(circ.num_qubits, 0);
+
+  for (const auto &op : circ.ops) {
+    switch (op.type) {
+      case Operations::OpType::measure:
+        features.num_measure++;
+        break;
+      case Operations::OpType::gate:
+      case Operations::OpType::matrix:
+      case Operations::OpType::multiplexer:
+      case Operations::OpType::kraus:
+      case Operations::OpType::superop:
+      case Operations::OpType::thermal_relaxation:
+      case Operations::OpType::reset:
+      case Operations::OpType::initialize: {
+        if (op.qubits.empty())
+          break;
+        const uint_t width = op.qubits.size();
+        if (features.op_widths.size() <= width)
+          features.op_widths.resize(width + 1, 0);
+        features.op_widths[width]++;
+        if (op.type != Operations::OpType::reset &&
+            (op.type != Operations::OpType::gate ||
+             clifford_gates.find(op.name) == clifford_gates.end()))
+          features.num_non_clifford++;
+        if (width > 1) {
+          const auto minmax = std::minmax_element(op.qubits.begin(),
+                                                  op.qubits.end());
+          const uint_t first = *minmax.first;
+          const uint_t last = *minmax.second;
+          for (uint_t k = first; k < last && k < circ.num_qubits; ++k)
+            features.cut_crossings[k]++;
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+  return features;
+}
+
+CostEstimate DefaultCostModel::estimate(const std::string &method,
+                                        const CircuitFeatures &features) const {
+  const int nq = static_cast<int>(features.num_qubits);
+  const double n = features.num_qubits;
+  const double shots = features.shots;
+  const double measures = features.num_measure;
+  const double repeats = (features.measure_sampling) ? 1. : shots;
+  double num_ops = 0.;
+  for (const auto &count : features.op_widths)
+    num_ops += count;
+
+  CostEstimate cost;
+  if (method == "statevector") {
+    double runtime = measures * std::ldexp(1., nq);
+    for (size_t k = 0; k < features.op_widths.size(); ++k)
+      runtime +=
+          features.op_widths[k] * std::ldexp(1., nq + static_cast<int>(k));
+    cost.runtime = repeats * runtime;
+    if (features.measure_sampling)
+      cost.runtime += std::ldexp(1., nq) + shots * measures;
+    cost.memory_mb = std::ldexp(16., nq - 20);
+  } else if (method == "density_matrix") {
+    double runtime = measures * std::ldexp(1., 2 * nq);
+    for (size_t k = 0; k < features.op_widths.size(); ++k)
+      runtime += features.op_widths[k] *
+                 std::ldexp(1., 2 * (nq + static_cast<int>(k)));
+    cost.runtime = repeats * runtime;
+    if (features.measure_sampling)
+      cost.runtime += std::ldexp(1., nq) + shots * measures;
+    cost.memory_mb = std::ldexp(16., 2 * nq - 20);
+  } else if (method == "stabilizer") {
+    cost.runtime = repeats * (2. * n * num_ops + n * n * measures);
+    if (features.measure_sampling)
+      cost.runtime += shots * n * n * measures;
+    cost.memory_mb = std::ldexp(4. * n * n, -20);
+  } else if (method == "matrix_product_state") {
+    // Bound on the log2 bond dimension at each cut
+    std::vector<double> log_chi(features.cut_crossings.size(), 0.);
+    double max_log_chi = 0.;
+    for (size_t k = 0; k + 1 < features.cut_crossings.size(); ++k) {
+      log_chi[k] = std::min<double>(
+          {static_cast<double>(features.cut_crossings[k]), k + 1., n - k - 1.});
+      max_log_chi = std::max(max_log_chi, log_chi[k]);
+    }
+    const double chi = std::exp2(std::min(max_log_chi, max_log2_chi_));
+    // Multi-qubit instructions swap qubits to be adjacent and back, so
+    // the number of two-qubit tensor updates is twice the number of
+    // cuts crossed by each instruction
+    double crossings = 0.;
+    for (const auto &count : features.cut_crossings)
+      crossings += count;
+    double runtime = num_ops * mps_op_overhead_;
+    runtime += measures * chi * chi * chi;
+    if (features.op_widths.size() > 1)
+      runtime += features.op_widths[1] * 4. * chi * chi;
+    runtime += 2. * crossings * 8. * chi * chi * chi;
+    cost.runtime = repeats * runtime;
+    if (features.measure_sampling)
+      cost.runtime += shots * measures * 4. * chi * chi;
+    double memory = 0.;
+    double left = 1.;
+    for (size_t k = 0; k < log_chi.size(); ++k) {
+      const double right =
+          (k + 1 < log_chi.size())
+              ? std::exp2(std::min(log_chi[k], max_log2_chi_))
+              : 1.;
+      memory += 2. * 16. * left * right;
+      left = right;
+    }
+    cost.memory_mb = std::ldexp(memory, -20);
+  } else if (method == "extended_stabilizer") {
+    // The stabilizer extent grows exponentially with the number of
+    // non-Clifford instructions so it is computed in log space
+    const double log2_extent =
+        features.num_non_clifford * std::log2(extended_stabilizer_extent_);
+    const double chi =
+        std::ceil(std::exp2(std::min(log2_extent, max_log2_chi_)) /
+                  (extended_stabilizer_delta_ * extended_stabilizer_delta_));
+    cost.runtime =
+        repeats * chi *
+        (2. * n * num_ops + extended_stabilizer_mixing_time_ * n * n * measures);
+    cost.memory_mb = std::ldexp(chi * 4. * n * n, -20);
+  } else {
+    throw std::invalid_argument(
+        "DefaultCostModel: no cost estimate for method \"" + method + "\".");
+  }
+  return cost;
+}
+
+//-------------------------------------------------------------------------
+} // end namespace Simulator
+//-------------------------------------------------------------------------
+} // end namespace AER
+//-------------------------------------------------------------------------
+#endif
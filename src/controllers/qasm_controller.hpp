@@ -15,11 +15,19 @@
 #ifndef _aer_qasm_controller_hpp_
 #define _aer_qasm_controller_hpp_
 
+#include <deque>
+#include <limits>
+
 #include "controller.hpp"
+#include "cost_model.hpp"
+#include "state_cache.hpp"
+#include "framework/checkpoint.hpp"
 #include "simulators/density_matrix/densitymatrix_state.hpp"
 #include "simulators/extended_stabilizer/extended_stabilizer_state.hpp"
 #include "simulators/matrix_product_state/matrix_product_state.hpp"
+#include "simulators/stabilizer/pauli_frame.hpp"
 #include "simulators/stabilizer/stabilizer_state.hpp"
+#include "simulators/statevector/batched_qubitvector.hpp"
 #include "simulators/statevector/statevector_state.hpp"
 #include "simulators/superoperator/superoperator_state.hpp"
 #include "transpile/basic_opts.hpp"
@@ -39,6 +47,72 @@ namespace Simulator {
  *   optimizations passes for an ideal circuit [Default: 0].
  * - "optimize_noise_threshold" (int): Qubit threshold for running circuit
  *   optimizations passes for a noisy circuit [Default: 12].
+ * - "adaptive_shots" (bool): Execute shots that cannot use measure sampling
+ *   in batches and stop once the standard error of the tracked observable
+ *   is below "adaptive_shots_target_error" [Default: False].
+ * - "adaptive_shots_target_error" (double): Target standard error for
+ *   adaptive shot execution [Default: 0.01].
+ * - "adaptive_shots_batch_size" (int): Number of shots executed between
+ *   adaptive shot convergence checks. The shots of a batch are executed in
+ *   parallel unless checkpointing is enabled [Default: 100].
+ * - "adaptive_shots_min_shots" (int): Minimum number of shots executed
+ *   before adaptive shot execution may stop [Default: 1000].
+ * - "adaptive_shots_observable" (str): Data used for the adaptive shot
+ *   convergence check. Either "counts" for the outcome probabilities or
+ *   "expectation_value" for averaged expectation value snapshots that
+ *   record their variance [Default: "counts"].
+ * - "checkpoint_directory" (str): Existing directory used to store
+ *   checkpoints of running experiments. If a checkpoint for an experiment
+ *   is found it is resumed. Resuming requires the same Qobj, including
+ *   "seed_simulator", and parallelization settings. If empty checkpointing
+ *   is disabled [Default: ""].
+ * - "checkpoint_period" (double): Number of seconds between checkpoints of
+ *   a running experiment [Default: 600].
+ * - "noise_streaming" (bool): Simulate noisy shots of the statevector method
+ *   by applying the sampled errors of each op directly to the state,
+ *   instead of sampling a noisy circuit for each shot. Not used for
+ *   circuits that are changed by the circuit optimizations of noisy shots,
+ *   such as fusion [Default: True].
+ * - "batched_shots" (int): Number of noisy shots that are simulated together
+ *   as a batch by the statevector method. Gates are applied to every shot
+ *   of the batch at once, and sampled gate and unitary matrix errors to
+ *   single shots of the batch. Batches are not used with adaptive shots,
+ *   checkpointing, sparse noise sampling, or for circuits containing
+ *   snapshots. Batching is opt-in as the speedup over single shots is
+ *   currently less than 2x. Values less than 2 disable batching
+ *   [Default: 1].
+ * - "batched_shots_threshold" (int): Maximum number of qubits of a circuit
+ *   for simulating noisy shots in batches [Default: 12].
+ * - "sparse_noise_threshold" (double): Maximum expected number of
+ *   non-identity error events per shot for sampling the error events of
+ *   all shots before execution. Shots with the same error events are then
+ *   executed once, and shots without errors may use measurement sampling.
+ *   Not used with adaptive shots, checkpointing, or for circuits
+ *   containing snapshots. Set to 0 to disable [Default: 4].
+ * - "sparse_noise_cache_mb" (int): Memory in MB for caching statevectors
+ *   of sparse noise sampling. For circuits that can use measure sampling
+ *   each pattern of error events resumes from a cached statevector of the
+ *   error events it shares with previous patterns. Least recently used
+ *   statevectors are evicted when the cache is full. Set to 0 to disable
+ *   [Default: 256].
+ * - "pauli_frame_simulation" (bool): Simulate noisy shots of the stabilizer
+ *   method by propagating the Pauli frame of each shot relative to a single
+ *   reference shot of the ideal circuit. This is used for circuits without
+ *   conditionals or snapshots when every quantum error of the noise model
+ *   is a mixture of Pauli gates, and takes precedence over sparse noise
+ *   sampling. Not used with adaptive shots or checkpointing
+ *   [Default: True].
+ * - "probabilities_with_readout" (bool): For circuits that use measure
+ *   sampling and only return counts, compute the exact probabilities of
+ *   the memory values after readout errors from the measured qubit
+ *   probabilities of the statevector and density matrix methods. The
+ *   distribution is returned as "probabilities_with_readout" data and
+ *   the counts are drawn from it as a single multinomial sample
+ *   [Default: False].
+ * - "probabilities_with_readout_threshold" (int): Maximum number of
+ *   measured qubits for computing "probabilities_with_readout". Larger
+ *   circuits sample the measurement outcomes of each shot instead
+ *   [Default: 20].
  *
  * From Statevector::State class
  *
@@ -130,6 +204,9 @@ class QasmController : public Base::Controller {
   // Clear the current config
   void virtual clear_config() override;
 
+  // Set the cost model used to choose the automatic simulation method
+  void set_cost_model(const std::shared_ptr<CostModel> &cost_model);
+
  protected:
   //-----------------------------------------------------------------------
   // Simulation types
@@ -152,6 +229,9 @@ class QasmController : public Base::Controller {
   // Simulation precision
   enum class Precision { double_precision, single_precision };
 
+  // Observable used for the adaptive shots stopping criterion
+  enum class AdaptiveObservable { counts, expectation_value };
+
   //-----------------------------------------------------------------------
   // Base class abstract method override
   //-----------------------------------------------------------------------
@@ -164,6 +244,14 @@ class QasmController : public Base::Controller {
                                      const json_t &config, uint_t shots,
                                      uint_t rng_seed) const override;
 
+  // Execute all shots of a circuit. Adaptive shots executed by several
+  // shot threads are run in batches split between the threads, and the
+  // stopping criterion is checked on the combined data of each batch.
+  virtual ExperimentData execute_shots(const Circuit &circ,
+                                       const Noise::NoiseModel &noise,
+                                       const json_t &config,
+                                       uint_t experiment) const override;
+
   //----------------------------------------------------------------
   // Utility functions
   //----------------------------------------------------------------
@@ -171,9 +259,21 @@ class QasmController : public Base::Controller {
   // Return the simulation method to use for the input circuit
   // If a custom method is specified in the config this will be
   // used. If the default automatic method is set this will choose
-  // the appropriate method based on the input circuit.
+  // the appropriate method based on the input circuit. If estimates is not
+  // null the cost estimates of an automatic method choice are added to it.
   Method simulation_method(const Circuit &circ, const Noise::NoiseModel &noise,
-                           bool validate = false) const;
+                           bool validate = false,
+                           json_t *estimates = nullptr) const;
+
+  // Return the automatic simulation method for the input circuit.
+  // Clifford circuits use the stabilizer method, otherwise the exact method
+  // with the lowest estimated runtime that fits in available memory is
+  // chosen. If estimates is not null the runtime and memory estimates of
+  // each method supporting the circuit are added to it.
+  Method automatic_simulation_method(const Circuit &circ,
+                                     const Noise::NoiseModel &noise,
+                                     bool validate = false,
+                                     json_t *estimates = nullptr) const;
 
   // Initialize a State subclass to a given initial state
   template <class State_t, class Initstate_t>
@@ -195,7 +295,8 @@ class QasmController : public Base::Controller {
                                     const json_t &config, uint_t shots,
                                     uint_t rng_seed,
                                     const Initstate_t &initial_state,
-                                    const Method method) const;
+                                    const Method method,
+                                    const json_t &estimates) const;
 
   // Execute a single shot a circuit by initializing the state vector
   // to initial_state, running all ops in circ, and updating data with
@@ -214,7 +315,7 @@ class QasmController : public Base::Controller {
                                  State_t &state,
                                  const Initstate_t &initial_state,
                                  const Method method, ExperimentData &data,
-                                 RngEngine &rng) const;
+                                 RngEngine &rng, Checkpoint &checkpoint) const;
 
   // Execute n-shots of a circuit with noise by sampling a new noisy
   // instance of the circuit for each shot.
@@ -222,7 +323,214 @@ class QasmController : public Base::Controller {
   void run_circuit_with_noise(const Circuit &circ,
                               const Noise::NoiseModel &noise, uint_t shots,
                               State_t &state, const Initstate_t &initial_state,
-                              ExperimentData &data, RngEngine &rng) const;
+                              const Method method, ExperimentData &data,
+                              RngEngine &rng, Checkpoint &checkpoint) const;
+
+  // Execute n-shots of a circuit with noise by streaming the ops of the
+  // circuit and the errors sampled for each shot to the state, without
+  // building a noisy circuit for each shot.
+  // Returns false if streaming is disabled or not supported for the State
+  // class, or the circuit is changed by optimizing it for each shot, in
+  // which case no shots were executed.
+  template <class State_t, class Initstate_t>
+  bool run_circuit_with_noise_streaming(const Circuit &circ,
+                                        const Noise::NoiseModel &noise,
+                                        const Noise::NoiseModel::CircuitErrors &errors,
+                                        uint_t shots, State_t &state,
+                                        const Initstate_t &initial_state,
+                                        ExperimentData &data, RngEngine &rng,
+                                        Checkpoint &checkpoint) const;
+
+  template <class statevec_t, class Initstate_t>
+  bool run_circuit_with_noise_streaming(const Circuit &circ,
+                                        const Noise::NoiseModel &noise,
+                                        const Noise::NoiseModel::CircuitErrors &errors,
+                                        uint_t shots,
+                                        Statevector::State<statevec_t> &state,
+                                        const Initstate_t &initial_state,
+                                        ExperimentData &data, RngEngine &rng,
+                                        Checkpoint &checkpoint) const;
+
+  // Apply the ops of a circuit to an initialized state, interleaved with
+  // errors sampled from the noise model. The ops of the circuit are applied
+  // by reference and the sampled errors of each op are written to the
+  // reusable noise_before and noise_after buffers.
+  template <class State_t>
+  void apply_ops_with_noise(const Circuit &circ,
+                            const Noise::NoiseModel &noise,
+                            const Noise::NoiseModel::CircuitErrors &errors,
+                            State_t &state,
+                            Noise::NoiseModel::NoiseOps &noise_before,
+                            Noise::NoiseModel::NoiseOps &noise_after,
+                            ExperimentData &data, RngEngine &rng) const;
+
+  // Execute n-shots of a circuit with noise by sampling the error events
+  // of every shot before execution. Shots with the same error events are
+  // executed together as a single noisy circuit, so that shots without
+  // errors can use the measurement sampling optimization.
+  // Returns false if sparse sampling is not supported for the circuit or
+  // the expected number of error events per shot is above the threshold,
+  // in which case no shots were executed.
+  template <class State_t, class Initstate_t>
+  bool run_circuit_with_sparse_noise(const Circuit &circ,
+                                     const Noise::NoiseModel &noise,
+                                     const Noise::NoiseModel::CircuitErrors &errors,
+                                     uint_t shots, State_t &state,
+                                     const Initstate_t &initial_state,
+                                     const Method method, ExperimentData &data,
+                                     RngEngine &rng,
+                                     Checkpoint &checkpoint) const;
+
+  // Execute the shots of a single pattern of error events as a noisy
+  // circuit
+  template <class State_t, class Initstate_t>
+  void run_error_pattern(const Circuit &circ, const Noise::NoiseModel &noise,
+                         const Noise::NoiseModel::CircuitErrors &errors,
+                         const Noise::NoiseModel::ErrorPattern &pattern,
+                         uint_t shots, State_t &state,
+                         const Initstate_t &initial_state, const Method method,
+                         ExperimentData &data, RngEngine &rng,
+                         Checkpoint &checkpoint) const;
+
+  // Execute the shots of each pattern of error events of a circuit that
+  // can use measure sampling, resuming each pattern from a cached state of
+  // the longest prefix of its error events it shares with a previous
+  // pattern. Each pattern is simulated once and its measure outcomes are
+  // sampled for all of its shots.
+  // Returns false if the circuit is not supported, in which case no shots
+  // were executed.
+  template <class State_t, class Initstate_t>
+  bool run_error_patterns_cached(
+      const Circuit &circ, const Noise::NoiseModel &noise,
+      const Noise::NoiseModel::CircuitErrors &errors,
+      const std::map<Noise::NoiseModel::ErrorPattern, uint_t> &patterns,
+      State_t &state, const Initstate_t &initial_state, const Method method,
+      ExperimentData &data, RngEngine &rng, Checkpoint &checkpoint) const;
+
+  template <typename data_t, class Initstate_t>
+  bool run_error_patterns_cached(
+      const Circuit &circ, const Noise::NoiseModel &noise,
+      const Noise::NoiseModel::CircuitErrors &errors,
+      const std::map<Noise::NoiseModel::ErrorPattern, uint_t> &patterns,
+      Statevector::State<QV::QubitVector<data_t>> &state,
+      const Initstate_t &initial_state, const Method method,
+      ExperimentData &data, RngEngine &rng, Checkpoint &checkpoint) const;
+
+  // Execute n-shots of a Clifford circuit with Pauli errors by propagating
+  // the Pauli frame of each shot relative to a reference shot of the ideal
+  // circuit. The frames of 64 shots are updated together as words.
+  // Returns false if Pauli frames are not supported for the State class,
+  // the circuit or the noise model, in which case no shots were executed.
+  template <class State_t, class Initstate_t>
+  bool run_circuit_with_pauli_frames(const Circuit &circ,
+                                     const Noise::NoiseModel &noise,
+                                     const Noise::NoiseModel::CircuitErrors &errors,
+                                     uint_t shots, State_t &state,
+                                     const Initstate_t &initial_state,
+                                     ExperimentData &data, RngEngine &rng,
+                                     Checkpoint &checkpoint) const;
+
+  bool run_circuit_with_pauli_frames(const Circuit &circ,
+                                     const Noise::NoiseModel &noise,
+                                     const Noise::NoiseModel::CircuitErrors &errors,
+                                     uint_t shots, Stabilizer::State &state,
+                                     const Clifford::Clifford &initial_state,
+                                     ExperimentData &data, RngEngine &rng,
+                                     Checkpoint &checkpoint) const;
+
+  // Sample the quantum errors of an op that are applied before or after it
+  // for every shot of the Pauli frames
+  void apply_pauli_frame_errors(const Noise::NoiseModel &noise,
+                                const Noise::NoiseModel::OpErrors &errors,
+                                bool errors_after,
+                                Stabilizer::PauliFrame &frame,
+                                RngEngine &rng) const;
+
+  // Execute n-shots of a circuit with noise by simulating batches of
+  // shots together. Noise is sampled for each shot of a batch, ops are
+  // applied to every shot of the batch at once, and sampled gate and matrix
+  // errors are applied to single shots of the batch. Shots with other
+  // errors are updated one at a time.
+  // Returns false if batches are not supported for the State class or
+  // the circuit, in which case no shots were executed.
+  template <class State_t, class Initstate_t>
+  bool run_circuit_with_noise_batched(const Circuit &circ,
+                                      const Noise::NoiseModel &noise,
+                                      const Noise::NoiseModel::CircuitErrors &errors,
+                                      uint_t shots, State_t &state,
+                                      const Initstate_t &initial_state,
+                                      ExperimentData &data, RngEngine &rng,
+                                      Checkpoint &checkpoint) const;
+
+  template <typename data_t, class Initstate_t>
+  bool run_circuit_with_noise_batched(
+      const Circuit &circ, const Noise::NoiseModel &noise,
+      const Noise::NoiseModel::CircuitErrors &errors, uint_t shots,
+      Statevector::State<QV::QubitVector<data_t>> &state,
+      const Initstate_t &initial_state, ExperimentData &data, RngEngine &rng,
+      Checkpoint &checkpoint) const;
+
+  // Set mat to the vectorized matrix of an op that can be applied to
+  // every shot of a batch. Returns false if the op is not a gate or matrix,
+  // or is conditional.
+  bool batched_matrix(const Operations::Op &op, cvector_t &mat) const;
+
+  // Set mats to the vectorized matrices of sampled error ops that can be
+  // applied to a single shot of a batch, leaving the matrix of identity
+  // gates empty. Returns false if any op is not a gate or matrix, or is
+  // conditional.
+  bool batched_matrices(const Noise::NoiseModel::NoiseOps &ops,
+                        std::vector<cvector_t> &mats) const;
+
+  // Apply the matrices set by batched_matrices to a single shot of a batch
+  template <typename data_t>
+  void apply_lane_matrices(QV::BatchedQubitVector<data_t> &qregs, uint_t lane,
+                           const Noise::NoiseModel::NoiseOps &ops,
+                           const std::vector<cvector_t> &mats) const;
+
+  // Execute up to n-shots by calling `run_shot` once per shot.
+  // If adaptive shots are enabled shots are executed in batches and
+  // execution stops once the target standard error has been reached.
+  // If checkpointing is enabled the completed shots are periodically
+  // saved, and execution resumes from an existing shots checkpoint.
+  template <typename Lambda>
+  void run_shots(uint_t shots, ExperimentData &data, RngEngine &rng,
+                 Checkpoint &checkpoint, Lambda &&run_shot) const;
+
+  // Initialize the state and apply the input ops of a circuit.
+  // For states that support checkpointing the state, classical registers,
+  // data and rng are periodically saved, and execution resumes from
+  // an existing ops checkpoint.
+  template <class State_t, class Initstate_t>
+  void apply_ops_checkpoint(const Circuit &circ,
+                            const std::vector<Operations::Op> &ops,
+                            State_t &state, const Initstate_t &initial_state,
+                            ExperimentData &data, RngEngine &rng,
+                            Checkpoint &checkpoint) const;
+
+  template <typename data_t, class Initstate_t>
+  void apply_ops_checkpoint(
+      const Circuit &circ, const std::vector<Operations::Op> &ops,
+      Statevector::State<QV::QubitVector<data_t>> &state,
+      const Initstate_t &initial_state, ExperimentData &data, RngEngine &rng,
+      Checkpoint &checkpoint) const;
+
+  // Return the largest standard error of the adaptive shots observable
+  // for the data accumulated over the input number of shots.
+  // If the data contains no values of the observable with an estimable
+  // error a pair {false, 0} is returned.
+  std::pair<bool, double> adaptive_shots_error(const ExperimentData &data,
+                                               uint_t shots) const;
+
+  // Return true if adaptive shot execution may stop after the input number
+  // of shots, setting error to the standard error of the data
+  bool adaptive_shots_converged(const ExperimentData &data, uint_t shots,
+                                std::pair<bool, double> &error) const;
+
+  // Add the adaptive shots result metadata
+  void add_adaptive_shots_metadata(ExperimentData &data, uint_t shots,
+                                   bool converged,
+                                   const std::pair<bool, double> &error) const;
 
   //----------------------------------------------------------------
   // Measure sampling optimization
@@ -235,6 +543,60 @@ class QasmController : public Base::Controller {
                        uint_t shots, State_t &state, ExperimentData &data,
                        RngEngine &rng) const;
 
+  // Set probs to the Z-measurement outcome probabilities of the input
+  // qubits of the current state. Returns false if the state type doesn't
+  // support computing the probabilities.
+  template <class State_t>
+  bool measure_probs(const State_t &, const reg_t &, rvector_t &) const {
+    return false;
+  }
+
+  template <class statevec_t>
+  bool measure_probs(const Statevector::State<statevec_t> &state,
+                     const reg_t &qubits, rvector_t &probs) const;
+
+  template <class densmat_t>
+  bool measure_probs(const DensityMatrix::State<densmat_t> &state,
+                     const reg_t &qubits, rvector_t &probs) const;
+
+  // Return the exact distribution of the memory bits in memory_map after
+  // the readout error ops, from the outcome probabilities of the measured
+  // qubits. memory_map maps each memory bit to the position of its qubit
+  // in the measured qubits, and position j of the returned distribution
+  // stores the memory bit bits[j]. Each readout error op is applied as a
+  // transform on the distribution of its own memory bits.
+  rvector_t readout_distribution(
+      const rvector_t &probs,
+      const std::unordered_map<uint_t, uint_t> &memory_map,
+      const std::vector<Operations::Op> &roerror_ops,
+      const reg_t &bits) const;
+
+  //----------------------------------------------------------------
+  // Bit-sliced classical bits
+  //
+  // The memory and register bits of a number of shots are stored as a
+  // bit vector for each classical bit indexed by shot.
+  //----------------------------------------------------------------
+
+  // Apply a readout error op to the memory and register bits of each shot
+  void apply_readout_error(const Operations::Op &op,
+                           std::vector<BV::BinaryVector> &memory,
+                           std::vector<BV::BinaryVector> &registers,
+                           uint_t shots, RngEngine &rng) const;
+
+  // Apply a readout error op to a histogram of the integer value of the
+  // memory bits of each shot. The shots of each memory value are
+  // distributed over the readout outcomes by sampling a multinomial
+  // distribution.
+  void apply_readout_error(const Operations::Op &op,
+                           std::map<uint_t, uint_t> &counts,
+                           RngEngine &rng) const;
+
+  // Add the memory and register bits of each shot to data
+  void add_creg_to_data(const std::vector<BV::BinaryVector> &memory,
+                        const std::vector<BV::BinaryVector> &registers,
+                        uint_t shots, ExperimentData &data) const;
+
   // Check if measure sampling optimization is valid for the input circuit
   // if so return a pair {true, pos} where pos is the position of the
   // first measurement operation in the input circuit
@@ -264,6 +626,40 @@ class QasmController : public Base::Controller {
 
   // Controller-level parameter for CH method
   bool extended_stabilizer_measure_sampling_ = false;
+
+  // Adaptive shot execution
+  bool adaptive_shots_ = false;
+  double adaptive_shots_target_error_ = 0.01;
+  uint_t adaptive_shots_batch_size_ = 100;
+  uint_t adaptive_shots_min_shots_ = 1000;
+  AdaptiveObservable adaptive_shots_observable_ = AdaptiveObservable::counts;
+
+  // Checkpointing of running experiments
+  std::string checkpoint_directory_;
+  double checkpoint_period_ = 600;
+
+  // Batched execution of noisy shots
+  uint_t batched_shots_ = 1;
+  uint_t batched_shots_threshold_ = 12;
+
+  // Sparse sampling of noisy shots
+  double sparse_noise_threshold_ = 4.;
+  uint_t sparse_noise_cache_mb_ = 256;
+
+  // Apply sampled errors of noisy statevector shots directly to the state
+  bool noise_streaming_ = true;
+
+  // Pauli frame simulation of noisy stabilizer shots, in blocks of
+  // shots whose frames are stored together
+  bool pauli_frame_simulation_ = true;
+  uint_t pauli_frame_block_size_ = 4096;
+
+  // Exact outcome distribution with readout errors for measure sampling
+  bool probabilities_with_readout_ = false;
+  uint_t probabilities_with_readout_threshold_ = 20;
+
+  // Cost model for the automatic simulation method
+  std::shared_ptr<CostModel> cost_model_ = std::make_shared<DefaultCostModel>();
 };
 
 //=========================================================================
@@ -334,6 +730,55 @@ void QasmController::set_config(const json_t &config) {
   JSON::get_value(extended_stabilizer_measure_sampling_,
                   "extended_stabilizer_measure_sampling", config);
 
+  // Check for adaptive shot execution
+  JSON::get_value(adaptive_shots_, "adaptive_shots", config);
+  if (JSON::get_value(adaptive_shots_target_error_,
+                      "adaptive_shots_target_error", config) &&
+      adaptive_shots_target_error_ <= 0) {
+    throw std::invalid_argument(
+        "QasmController: adaptive_shots_target_error must be positive.");
+  }
+  if (JSON::get_value(adaptive_shots_batch_size_, "adaptive_shots_batch_size",
+                      config) &&
+      adaptive_shots_batch_size_ == 0) {
+    throw std::invalid_argument(
+        "QasmController: adaptive_shots_batch_size must be positive.");
+  }
+  JSON::get_value(adaptive_shots_min_shots_, "adaptive_shots_min_shots",
+                  config);
+  // Check for checkpointing
+  JSON::get_value(checkpoint_directory_, "checkpoint_directory", config);
+  JSON::get_value(checkpoint_period_, "checkpoint_period", config);
+  if (!checkpoint_directory_.empty() && !shot_sink_path_.empty()) {
+    throw std::invalid_argument(
+        "QasmController: checkpointing can't be used with a shot sink.");
+  }
+
+  // Check for batched noisy shots
+  JSON::get_value(batched_shots_, "batched_shots", config);
+  JSON::get_value(batched_shots_threshold_, "batched_shots_threshold", config);
+  JSON::get_value(sparse_noise_threshold_, "sparse_noise_threshold", config);
+  JSON::get_value(sparse_noise_cache_mb_, "sparse_noise_cache_mb", config);
+  JSON::get_value(pauli_frame_simulation_, "pauli_frame_simulation", config);
+  JSON::get_value(noise_streaming_, "noise_streaming", config);
+  JSON::get_value(probabilities_with_readout_, "probabilities_with_readout",
+                  config);
+  JSON::get_value(probabilities_with_readout_threshold_,
+                  "probabilities_with_readout_threshold", config);
+
+  std::string observable;
+  if (JSON::get_value(observable, "adaptive_shots_observable", config)) {
+    if (observable == "counts") {
+      adaptive_shots_observable_ = AdaptiveObservable::counts;
+    } else if (observable == "expectation_value") {
+      adaptive_shots_observable_ = AdaptiveObservable::expectation_value;
+    } else {
+      throw std::invalid_argument(
+          std::string("QasmController: Invalid adaptive shots observable (") +
+          observable + std::string(")."));
+    }
+  }
+
   // DEPRECATED: Add custom initial state
   if (JSON::get_value(initial_statevector_, "initial_statevector", config)) {
     // Raise error if method is set to stabilizer or ch
@@ -361,6 +806,29 @@ void QasmController::clear_config() {
   Base::Controller::clear_config();
   simulation_method_ = Method::automatic;
   initial_statevector_ = cvector_t();
+  adaptive_shots_ = false;
+  adaptive_shots_target_error_ = 0.01;
+  adaptive_shots_batch_size_ = 100;
+  adaptive_shots_min_shots_ = 1000;
+  adaptive_shots_observable_ = AdaptiveObservable::counts;
+  checkpoint_directory_.clear();
+  checkpoint_period_ = 600;
+  batched_shots_ = 1;
+  batched_shots_threshold_ = 12;
+  sparse_noise_threshold_ = 4.;
+  sparse_noise_cache_mb_ = 256;
+  pauli_frame_simulation_ = true;
+  noise_streaming_ = true;
+  probabilities_with_readout_ = false;
+  probabilities_with_readout_threshold_ = 20;
+}
+
+void QasmController::set_cost_model(
+    const std::shared_ptr<CostModel> &cost_model) {
+  if (!cost_model) {
+    throw std::invalid_argument("QasmController: cost model cannot be null.");
+  }
+  cost_model_ = cost_model;
 }
 
 //-------------------------------------------------------------------------
@@ -371,19 +839,21 @@ ExperimentData QasmController::run_circuit(const Circuit &circ,
                                            const Noise::NoiseModel &noise,
                                            const json_t &config, uint_t shots,
                                            uint_t rng_seed) const {
-  // Validate circuit for simulation method
-  switch (simulation_method(circ, noise, true)) {
+  // Validate circuit for simulation method, keeping the cost estimates
+  // used to choose an automatic method for the result metadata
+  json_t estimates;
+  switch (simulation_method(circ, noise, true, &estimates)) {
     case Method::statevector:
       if (simulation_precision_ == Precision::double_precision) {
         // Double-precision Statevector simulation
         return run_circuit_helper<Statevector::State<QV::QubitVector<double>>>(
             circ, noise, config, shots, rng_seed, initial_statevector_,
-            Method::statevector);
+            Method::statevector, estimates);
       } else {
         // Single-precision Statevector simulation
         return run_circuit_helper<Statevector::State<QV::QubitVector<float>>>(
             circ, noise, config, shots, rng_seed, initial_statevector_,
-            Method::statevector);
+            Method::statevector, estimates);
       }
     case Method::statevector_thrust_gpu:
 #ifndef AER_THRUST_CUDA
@@ -396,13 +866,13 @@ ExperimentData QasmController::run_circuit(const Circuit &circ,
         return run_circuit_helper<
             Statevector::State<QV::QubitVectorThrust<double>>>(
             circ, noise, config, shots, rng_seed, initial_statevector_,
-            Method::statevector_thrust_gpu);
+            Method::statevector_thrust_gpu, estimates);
       } else {
         // Single-precision Statevector simulation
         return run_circuit_helper<
             Statevector::State<QV::QubitVectorThrust<float>>>(
             circ, noise, config, shots, rng_seed, initial_statevector_,
-            Method::statevector_thrust_gpu);
+            Method::statevector_thrust_gpu, estimates);
       }
 #endif
     case Method::statevector_thrust_cpu:
@@ -416,13 +886,13 @@ ExperimentData QasmController::run_circuit(const Circuit &circ,
         return run_circuit_helper<
             Statevector::State<QV::QubitVectorThrust<double>>>(
             circ, noise, config, shots, rng_seed, initial_statevector_,
-            Method::statevector_thrust_cpu);
+            Method::statevector_thrust_cpu, estimates);
       } else {
         // Single-precision Statevector simulation
         return run_circuit_helper<
             Statevector::State<QV::QubitVectorThrust<float>>>(
             circ, noise, config, shots, rng_seed, initial_statevector_,
-            Method::statevector_thrust_cpu);
+            Method::statevector_thrust_cpu, estimates);
       }
 #endif
     case Method::density_matrix:
@@ -431,13 +901,13 @@ ExperimentData QasmController::run_circuit(const Circuit &circ,
         return run_circuit_helper<
             DensityMatrix::State<QV::DensityMatrix<double>>>(
             circ, noise, config, shots, rng_seed, cvector_t(),
-            Method::density_matrix);
+            Method::density_matrix, estimates);
       } else {
         // Single-precision density matrix simulation
         return run_circuit_helper<
             DensityMatrix::State<QV::DensityMatrix<float>>>(
             circ, noise, config, shots, rng_seed, cvector_t(),
-            Method::density_matrix);
+            Method::density_matrix, estimates);
       }
     case Method::density_matrix_thrust_gpu:
 #ifndef AER_THRUST_CUDA
@@ -450,13 +920,13 @@ ExperimentData QasmController::run_circuit(const Circuit &circ,
         return run_circuit_helper<
             DensityMatrix::State<QV::DensityMatrixThrust<double>>>(
             circ, noise, config, shots, rng_seed, cvector_t(),
-            Method::density_matrix_thrust_gpu);
+            Method::density_matrix_thrust_gpu, estimates);
       } else {
         // Single-precision density matrix simulation
         return run_circuit_helper<
             DensityMatrix::State<QV::DensityMatrixThrust<float>>>(
             circ, noise, config, shots, rng_seed, cvector_t(),
-            Method::density_matrix_thrust_gpu);
+            Method::density_matrix_thrust_gpu, estimates);
       }
 #endif
     case Method::density_matrix_thrust_cpu:
@@ -470,13 +940,13 @@ ExperimentData QasmController::run_circuit(const Circuit &circ,
         return run_circuit_helper<
             DensityMatrix::State<QV::DensityMatrixThrust<double>>>(
             circ, noise, config, shots, rng_seed, cvector_t(),
-            Method::density_matrix_thrust_cpu);
+            Method::density_matrix_thrust_cpu, estimates);
       } else {
         // Single-precision density matrix simulation
         return run_circuit_helper<
             DensityMatrix::State<QV::DensityMatrixThrust<float>>>(
             circ, noise, config, shots, rng_seed, cvector_t(),
-            Method::density_matrix_thrust_cpu);
+            Method::density_matrix_thrust_cpu, estimates);
       }
 #endif
     case Method::stabilizer:
@@ -484,16 +954,16 @@ ExperimentData QasmController::run_circuit(const Circuit &circ,
       // TODO: Stabilizer doesn't yet support custom state initialization
       return run_circuit_helper<Stabilizer::State>(
           circ, noise, config, shots, rng_seed, Clifford::Clifford(),
-          Method::stabilizer);
+          Method::stabilizer, estimates);
     case Method::extended_stabilizer:
       return run_circuit_helper<ExtendedStabilizer::State>(
           circ, noise, config, shots, rng_seed, CHSimulator::Runner(),
-          Method::extended_stabilizer);
+          Method::extended_stabilizer, estimates);
 
     case Method::matrix_product_state:
       return run_circuit_helper<MatrixProductState::State>(
           circ, noise, config, shots, rng_seed, MatrixProductState::MPS(),
-          Method::matrix_product_state);
+          Method::matrix_product_state, estimates);
 
     default:
       throw std::runtime_error("QasmController:Invalid simulation method");
@@ -506,7 +976,7 @@ ExperimentData QasmController::run_circuit(const Circuit &circ,
 
 QasmController::Method QasmController::simulation_method(
     const Circuit &circ, const Noise::NoiseModel &noise_model,
-    bool validate) const {
+    bool validate, json_t *estimates) const {
   // Check simulation method and validate state
   switch (simulation_method_) {
     case Method::statevector: {
@@ -622,60 +1092,102 @@ QasmController::Method QasmController::simulation_method(
         validate_state(MatrixProductState::State(), circ, noise_model, true);
       return Method::matrix_product_state;
     }
-    case Method::automatic: {
-      // If circuit and noise model are Clifford run on Stabilizer simulator
-      if (validate_state(Stabilizer::State(), circ, noise_model, false)) {
-        return Method::stabilizer;
-      }
-      // For noisy simulations we enable the density matrix method if
-      // shots > 2 ** num_qubits. This is based on a rough estimate that
-      // a single shot of the density matrix simulator is approx 2 ** nq
-      // times slow than a single shot of statevector due the increased
-      // dimension
-      if (noise_model.has_quantum_errors() &&
-          circ.shots > (1 << circ.num_qubits) &&
-          validate_memory_requirements(DensityMatrix::State<>(), circ, false) &&
-          validate_state(DensityMatrix::State<>(), circ, noise_model, false) &&
-          check_measure_sampling_opt(circ, Method::density_matrix).first) {
-        return Method::density_matrix;
-      }
-      // Finally we check the statevector memory requirement for the
-      // current number of qubits. If it fits in available memory we
-      // default to the Statevector method. Otherwise we attempt to use
-      // the extended stabilizer simulator.
-      bool enough_memory = true;
-      if (simulation_precision_ == Precision::single_precision) {
-        Statevector::State<QV::QubitVector<float>> sv_state;
-        enough_memory = validate_memory_requirements(sv_state, circ, false);
-      } else {
-        Statevector::State<> sv_state;
-        enough_memory = validate_memory_requirements(sv_state, circ, false);
-      }
-      if (!enough_memory) {
-        if (validate_state(ExtendedStabilizer::State(), circ, noise_model,
-                           false)) {
-          return Method::extended_stabilizer;
-        } else {
-          throw std::runtime_error(
-              "QasmSimulator: Circuit cannot be run using available methods.");
-        }
-      }
-    }
-    // If we didn't select extended stabilizer above proceed to the default
-    // switch clause
-    default: {
-      // For default we use statevector followed by density matrix (for the case
-      // when the circuit contains invalid instructions for statevector)
-      if (validate_state(Statevector::State<>(), circ, noise_model, false)) {
-        return Method::statevector;
-      }
-      // If circuit contains invalid instructions for statevector throw a hail
-      // mary and try for density matrix.
-      if (validate)
-        validate_state(DensityMatrix::State<>(), circ, noise_model, true);
-      return Method::density_matrix;
+    case Method::automatic:
+      return automatic_simulation_method(circ, noise_model, validate,
+                                         estimates);
+    default:
+      throw std::runtime_error("QasmController:Invalid simulation method");
+  }
+}
+
+QasmController::Method QasmController::automatic_simulation_method(
+    const Circuit &circ, const Noise::NoiseModel &noise_model, bool validate,
+    json_t *estimates) const {
+  // Estimate the cost of each method that can simulate the circuit
+  auto features = circuit_features(circ);
+  features.noise = noise_model.has_quantum_errors();
+  bool any_valid = false;
+  std::map<Method, bool> fits;
+  std::map<Method, double> runtimes;
+  auto add_estimate = [&](const Method method, const std::string &name,
+                          bool enough_memory) {
+    any_valid = true;
+    // Trajectory methods sample a noisy circuit for each shot, while the
+    // density matrix method applies the noise as superoperators
+    features.measure_sampling =
+        (!features.noise || method == Method::density_matrix) &&
+        check_measure_sampling_opt(circ, method).first;
+    const auto cost = cost_model_->estimate(name, features);
+    fits[method] = enough_memory &&
+                   (max_memory_mb_ == 0 || cost.memory_mb <= max_memory_mb_);
+    runtimes[method] = cost.runtime;
+    if (estimates != nullptr) {
+      (*estimates)[name]["runtime"] = cost.runtime;
+      (*estimates)[name]["memory_mb"] = cost.memory_mb;
+      (*estimates)[name]["measure_sampling"] = features.measure_sampling;
     }
+  };
+
+  if (validate_state(Stabilizer::State(), circ, noise_model, false)) {
+    add_estimate(Method::stabilizer, "stabilizer", true);
+  }
+  if (simulation_precision_ == Precision::single_precision) {
+    Statevector::State<QV::QubitVector<float>> sv_state;
+    if (validate_state(sv_state, circ, noise_model, false))
+      add_estimate(Method::statevector, "statevector",
+                   validate_memory_requirements(sv_state, circ, false));
+    DensityMatrix::State<QV::DensityMatrix<float>> dm_state;
+    if (validate_state(dm_state, circ, noise_model, false))
+      add_estimate(Method::density_matrix, "density_matrix",
+                   validate_memory_requirements(dm_state, circ, false));
+  } else {
+    Statevector::State<QV::QubitVector<double>> sv_state;
+    if (validate_state(sv_state, circ, noise_model, false))
+      add_estimate(Method::statevector, "statevector",
+                   validate_memory_requirements(sv_state, circ, false));
+    DensityMatrix::State<QV::DensityMatrix<double>> dm_state;
+    if (validate_state(dm_state, circ, noise_model, false))
+      add_estimate(Method::density_matrix, "density_matrix",
+                   validate_memory_requirements(dm_state, circ, false));
+  }
+  if (validate_state(MatrixProductState::State(), circ, noise_model, false)) {
+    add_estimate(Method::matrix_product_state, "matrix_product_state", true);
   }
+  ExtendedStabilizer::State ch_state;
+  if (validate_state(ch_state, circ, noise_model, false)) {
+    add_estimate(Method::extended_stabilizer, "extended_stabilizer",
+                 validate_memory_requirements(ch_state, circ, false));
+  }
+
+  // If circuit and noise model are Clifford run on Stabilizer simulator
+  if (fits[Method::stabilizer])
+    return Method::stabilizer;
+
+  // Otherwise choose the exact method with the lowest estimated runtime
+  // that fits in available memory
+  Method method = Method::automatic;
+  for (const auto &candidate : {Method::statevector, Method::density_matrix,
+                                Method::matrix_product_state}) {
+    if (fits[candidate] && (method == Method::automatic ||
+                            runtimes[candidate] < runtimes[method]))
+      method = candidate;
+  }
+  if (method != Method::automatic)
+    return method;
+
+  // If no exact method fits in memory we attempt to use the approximate
+  // extended stabilizer simulator
+  if (fits[Method::extended_stabilizer])
+    return Method::extended_stabilizer;
+  if (any_valid)
+    throw std::runtime_error(
+        "QasmSimulator: Circuit cannot be run using available methods.");
+
+  // If circuit contains invalid instructions for all methods throw a hail
+  // mary and try for density matrix.
+  if (validate)
+    validate_state(DensityMatrix::State<>(), circ, noise_model, true);
+  return Method::density_matrix;
 }
 
 template <class State_t, class Initstate_t>
@@ -734,6 +1246,14 @@ size_t QasmController::required_memory_mb(
 
 void QasmController::set_parallelization_circuit(
     const Circuit &circ, const Noise::NoiseModel &noise_model) {
+  // Adaptive shots are checkpointed with the accumulated data of all shots
+  // so checkpointed shots must be executed sequentially
+  if (adaptive_shots_ && !checkpoint_directory_.empty()) {
+    parallel_shots_ = 1;
+    parallel_state_update_ =
+        std::max<int>({1, max_parallel_threads_ / parallel_experiments_});
+    return;
+  }
   const auto method = simulation_method(circ, noise_model, false);
   switch (method) {
     case Method::statevector:
@@ -777,7 +1297,7 @@ template <class State_t, class Initstate_t>
 ExperimentData QasmController::run_circuit_helper(
     const Circuit &circ, const Noise::NoiseModel &noise, const json_t &config,
     uint_t shots, uint_t rng_seed, const Initstate_t &initial_state,
-    const Method method) const {
+    const Method method, const json_t &estimates) const {
   // Initialize new state object
   State_t state;
 
@@ -795,15 +1315,31 @@ ExperimentData QasmController::run_circuit_helper(
   // Output data container
   ExperimentData data;
   data.set_config(config);
+  data.set_shot_sink(shot_sink_);
+  data.reserve(shots);
   data.add_metadata("method", state.name());
+  // Add the cost estimates used to choose an automatic method to metadata
+  if (simulation_method_ == Method::automatic)
+    data.add_metadata("method_estimates", estimates);
   // Add measure sampling to metadata
   // Note: this will set to `true` if sampling is enabled for the circuit
   data.add_metadata("measure_sampling", false);
 
+  // Checkpoint file for the shots executed by this call
+  json_t checkpoint_id;
+  checkpoint_id["seed"] = rng_seed;
+  checkpoint_id["shots"] = shots;
+  checkpoint_id["num_qubits"] = circ.num_qubits;
+  checkpoint_id["num_ops"] = circ.ops.size();
+  checkpoint_id["method"] = state.name();
+  Checkpoint checkpoint(checkpoint_directory_,
+                        "checkpoint_" + std::to_string(rng_seed) + ".bin",
+                        checkpoint_period_, checkpoint_id);
+
   // Choose execution method based on noise and method
   if (noise.is_ideal()) {
     run_circuit_without_noise(circ, shots, state, initial_state, method, data,
-                              rng);
+                              rng, checkpoint);
   } else if ((method == Method::density_matrix ||
               method == Method::density_matrix_thrust_gpu ||
               method == Method::density_matrix_thrust_cpu) &&
@@ -814,17 +1350,22 @@ ExperimentData QasmController::run_circuit_helper(
     noise_cpy.activate_superop_method();
     Circuit noise_circ = noise_cpy.sample_noise(circ, rng);
     run_circuit_without_noise(noise_circ, shots, state, initial_state, method,
-                              data, rng);
+                              data, rng, checkpoint);
   } else if (noise.has_quantum_errors() == false) {
     // We can insert the readout errors from the noise model and then
     // execute the resulting circuit
     Circuit noise_circ = noise.sample_noise(circ, rng);
     run_circuit_without_noise(noise_circ, shots, state, initial_state, method,
-                              data, rng);
+                              data, rng, checkpoint);
   } else {
     // Run sampling a noisy instance of the circuit for each shot
-    run_circuit_with_noise(circ, noise, shots, state, initial_state, data, rng);
+    run_circuit_with_noise(circ, noise, shots, state, initial_state, method,
+                           data, rng, checkpoint);
   }
+  // Execution completed so the checkpoint is no longer needed
+  checkpoint.remove();
+  // Write the remaining per-shot data to the shot sink
+  data.flush_shot_sink();
   return data;
 }
 
@@ -843,18 +1384,792 @@ void QasmController::run_circuit_with_noise(const Circuit &circ,
                                             const Noise::NoiseModel &noise,
                                             uint_t shots, State_t &state,
                                             const Initstate_t &initial_state,
+                                            const Method method,
                                             ExperimentData &data,
-                                            RngEngine &rng) const {
+                                            RngEngine &rng,
+                                            Checkpoint &checkpoint) const {
+  // Resolve the noise model errors of each op once for all shots
+  const auto errors = noise.compile_errors(circ);
+  if (run_circuit_with_pauli_frames(circ, noise, errors, shots, state,
+                                    initial_state, data, rng, checkpoint))
+    return;
+  if (run_circuit_with_sparse_noise(circ, noise, errors, shots, state,
+                                    initial_state, method, data, rng,
+                                    checkpoint))
+    return;
+  if (run_circuit_with_noise_batched(circ, noise, errors, shots, state,
+                                     initial_state, data, rng, checkpoint))
+    return;
+  if (run_circuit_with_noise_streaming(circ, noise, errors, shots, state,
+                                       initial_state, data, rng, checkpoint))
+    return;
   // Sample a new noise circuit and optimize for each shot
-  while (shots-- > 0) {
-    Circuit noise_circ = noise.sample_noise(circ, rng);
+  run_shots(shots, data, rng, checkpoint, [&]() {
+    Circuit noise_circ = noise.sample_noise(circ, errors, rng);
     noise_circ.shots = 1;
     if (noise_circ.num_qubits > circuit_opt_noise_threshold_) {
       Noise::NoiseModel dummy;
       optimize_circuit(noise_circ, dummy, state, data);
     }
     run_single_shot(noise_circ, state, initial_state, data, rng);
+  });
+}
+
+template <class State_t, class Initstate_t>
+bool QasmController::run_circuit_with_noise_streaming(
+    const Circuit &, const Noise::NoiseModel &,
+    const Noise::NoiseModel::CircuitErrors &, uint_t, State_t &,
+    const Initstate_t &, ExperimentData &, RngEngine &, Checkpoint &) const {
+  return false;
+}
+
+template <class statevec_t, class Initstate_t>
+bool QasmController::run_circuit_with_noise_streaming(
+    const Circuit &circ, const Noise::NoiseModel &noise,
+    const Noise::NoiseModel::CircuitErrors &errors, uint_t shots,
+    Statevector::State<statevec_t> &state, const Initstate_t &initial_state,
+    ExperimentData &data, RngEngine &rng, Checkpoint &checkpoint) const {
+  if (!noise_streaming_)
+    return false;
+  // Noisy circuits of large numbers of qubits are optimized for each shot.
+  // Whether the optimizations change the circuit, for example if it is
+  // large enough for fusion, is checked once on the ideal circuit.
+  if (circ.num_qubits > circuit_opt_noise_threshold_) {
+    Circuit opt_circ = circ;
+    opt_circ.shots = 1;
+    Noise::NoiseModel dummy;
+    ExperimentData dummy_data;
+    optimize_circuit(opt_circ, dummy, state, dummy_data);
+    // Barriers are removed without changing the circuit
+    auto num_ops = [](const Circuit &c) {
+      return std::count_if(c.ops.begin(), c.ops.end(),
+                           [](const Operations::Op &op) {
+                             return op.type != Operations::OpType::barrier;
+                           });
+    };
+    if (num_ops(opt_circ) != num_ops(circ))
+      return false;
+  }
+  // The error buffers are reused by every shot
+  Noise::NoiseModel::NoiseOps noise_before;
+  Noise::NoiseModel::NoiseOps noise_after;
+  run_shots(shots, data, rng, checkpoint, [&]() {
+    initialize_state(circ, state, initial_state);
+    apply_ops_with_noise(circ, noise, errors, state, noise_before,
+                         noise_after, data, rng);
+    state.add_creg_to_data(data);
+  });
+  data.add_metadata("noise_streaming", true);
+  return true;
+}
+
+template <class State_t>
+void QasmController::apply_ops_with_noise(
+    const Circuit &circ, const Noise::NoiseModel &noise,
+    const Noise::NoiseModel::CircuitErrors &errors, State_t &state,
+    Noise::NoiseModel::NoiseOps &noise_before,
+    Noise::NoiseModel::NoiseOps &noise_after, ExperimentData &data,
+    RngEngine &rng) const {
+  const Operations::Op *ops = circ.ops.data();
+  bool noise_active = true;
+  // Start of the current run of circuit ops without sampled errors
+  size_t start = 0;
+  for (size_t pos = 0; pos < circ.ops.size(); ++pos) {
+    noise_before.clear();
+    noise_after.clear();
+    const bool apply_op = noise.sample_noise(circ.ops[pos], errors[pos],
+                                             noise_active, noise_before,
+                                             noise_after, rng);
+    if (apply_op && noise_before.empty() && noise_after.empty())
+      continue;
+    state.apply_ops_range(ops + start, ops + pos, data, rng);
+    state.apply_ops_range(noise_before.data(),
+                          noise_before.data() + noise_before.size(), data, rng);
+    if (apply_op)
+      state.apply_ops_range(ops + pos, ops + pos + 1, data, rng);
+    state.apply_ops_range(noise_after.data(),
+                          noise_after.data() + noise_after.size(), data, rng);
+    start = pos + 1;
+  }
+  state.apply_ops_range(ops + start, ops + circ.ops.size(), data, rng);
+}
+
+template <class State_t, class Initstate_t>
+bool QasmController::run_circuit_with_sparse_noise(
+    const Circuit &circ, const Noise::NoiseModel &noise,
+    const Noise::NoiseModel::CircuitErrors &errors, uint_t shots,
+    State_t &state, const Initstate_t &initial_state, const Method method,
+    ExperimentData &data, RngEngine &rng, Checkpoint &checkpoint) const {
+  // Adaptive shots and checkpoints require shot by shot execution
+  if (!(sparse_noise_threshold_ > 0) || shots < 2 || adaptive_shots_ ||
+      checkpoint.enabled() || !noise.sparse_sampling_supported(circ, errors) ||
+      noise.expected_error_events(errors) > sparse_noise_threshold_) {
+    return false;
+  }
+  // The shots of each error pattern are executed together, so snapshots
+  // would be recorded once per pattern instead of once per shot
+  for (const auto &op : circ.ops) {
+    if (op.type == Operations::OpType::snapshot)
+      return false;
+  }
+  const auto patterns = noise.sample_error_patterns(errors, shots, rng);
+  if (!run_error_patterns_cached(circ, noise, errors, patterns, state,
+                                 initial_state, method, data, rng,
+                                 checkpoint)) {
+    for (const auto &pair : patterns)
+      run_error_pattern(circ, noise, errors, pair.first, pair.second, state,
+                        initial_state, method, data, rng, checkpoint);
   }
+  data.add_metadata("sparse_noise_patterns", patterns.size());
+  return true;
+}
+
+template <class State_t, class Initstate_t>
+void QasmController::run_error_pattern(
+    const Circuit &circ, const Noise::NoiseModel &noise,
+    const Noise::NoiseModel::CircuitErrors &errors,
+    const Noise::NoiseModel::ErrorPattern &pattern, uint_t shots,
+    State_t &state, const Initstate_t &initial_state, const Method method,
+    ExperimentData &data, RngEngine &rng, Checkpoint &checkpoint) const {
+  Circuit noise_circ = noise.error_pattern_circuit(circ, errors, pattern, rng);
+  noise_circ.shots = shots;
+  if (shots > 1 || pattern.empty()) {
+    run_circuit_without_noise(noise_circ, shots, state, initial_state, method,
+                              data, rng, checkpoint);
+  } else {
+    // Single noisy shots are optimized as in shot by shot execution
+    if (noise_circ.num_qubits > circuit_opt_noise_threshold_) {
+      Noise::NoiseModel dummy;
+      optimize_circuit(noise_circ, dummy, state, data);
+    }
+    run_single_shot(noise_circ, state, initial_state, data, rng);
+  }
+}
+
+template <class State_t, class Initstate_t>
+bool QasmController::run_error_patterns_cached(
+    const Circuit &, const Noise::NoiseModel &,
+    const Noise::NoiseModel::CircuitErrors &,
+    const std::map<Noise::NoiseModel::ErrorPattern, uint_t> &, State_t &,
+    const Initstate_t &, const Method, ExperimentData &, RngEngine &,
+    Checkpoint &) const {
+  return false;
+}
+
+template <typename data_t, class Initstate_t>
+bool QasmController::run_error_patterns_cached(
+    const Circuit &circ, const Noise::NoiseModel &noise,
+    const Noise::NoiseModel::CircuitErrors &errors,
+    const std::map<Noise::NoiseModel::ErrorPattern, uint_t> &patterns,
+    Statevector::State<QV::QubitVector<data_t>> &state,
+    const Initstate_t &initial_state, const Method method,
+    ExperimentData &data, RngEngine &rng, Checkpoint &checkpoint) const {
+  using ErrorPattern = Noise::NoiseModel::ErrorPattern;
+  // Large circuits are optimized for each pattern
+  if (sparse_noise_cache_mb_ == 0 || patterns.size() < 2 ||
+      circ.num_qubits > circuit_opt_noise_threshold_)
+    return false;
+  const auto check = check_measure_sampling_opt(circ, method);
+  if (!check.first)
+    return false;
+  const size_t meas_pos = check.second;
+
+  // Circuit position and first error location of each op
+  std::vector<size_t> location_pos;
+  std::vector<uint_t> first_location(circ.ops.size());
+  for (size_t pos = 0; pos < circ.ops.size(); ++pos) {
+    first_location[pos] = location_pos.size();
+    location_pos.insert(location_pos.end(),
+                        errors[pos].quantum_errors.size(), pos);
+  }
+
+  // The measure ops with their readout errors
+  std::vector<Operations::Op> meas_ops;
+  for (size_t pos = meas_pos; pos < circ.ops.size(); ++pos) {
+    meas_ops.push_back(circ.ops[pos]);
+    noise.sample_readout_noise(errors[pos], meas_ops, rng);
+  }
+
+  // The error events of a pattern are applied in groups of the events of
+  // the same op. A pattern is supported if its error events are before
+  // the measure ops and only add unitary ops, so that its final state is
+  // the same for every shot.
+  struct EventGroup {
+    size_t pos;          // circuit position of the op
+    size_t first_event;  // position of the first event in the pattern
+    Noise::NoiseModel::NoiseOps ops;
+  };
+  std::vector<std::vector<EventGroup>> pattern_groups;
+  std::vector<bool> supported;
+  // Circuit positions at which the state of each prefix of error events
+  // is required by the patterns in order
+  std::map<ErrorPattern, std::deque<size_t>> pending;
+  for (const auto &pair : patterns) {
+    const auto &pattern = pair.first;
+    std::vector<EventGroup> groups;
+    bool unitary = true;
+    auto event = pattern.cbegin();
+    while (unitary && event != pattern.cend()) {
+      const size_t pos = location_pos[event->location];
+      if (pos >= meas_pos) {
+        unitary = false;
+        break;
+      }
+      const size_t first_event = std::distance(pattern.cbegin(), event);
+      auto ops = noise.error_pattern_ops(circ.ops[pos], errors[pos],
+                                         first_location[pos], event,
+                                         pattern.cend(), rng);
+      for (const auto &op : ops) {
+        unitary &= !op.conditional &&
+                   (op.type == Operations::OpType::gate ||
+                    op.type == Operations::OpType::matrix ||
+                    op.type == Operations::OpType::multiplexer ||
+                    op.type == Operations::OpType::barrier);
+      }
+      groups.push_back({pos, first_event, std::move(ops)});
+    }
+    if (unitary) {
+      for (const auto &group : groups) {
+        const ErrorPattern prefix(pattern.begin(),
+                                  pattern.begin() + group.first_event);
+        pending[prefix].push_back(group.pos);
+      }
+    }
+    supported.push_back(unitary);
+    pattern_groups.push_back(std::move(groups));
+  }
+
+  StateCache<ErrorPattern, QV::QubitVector<data_t>> cache(
+      sparse_noise_cache_mb_ << 20);
+  uint_t cache_hits = 0;
+  size_t n = 0;
+  for (const auto &pair : patterns) {
+    const auto &pattern = pair.first;
+    const auto &groups = pattern_groups[n];
+    if (!supported[n++]) {
+      run_error_pattern(circ, noise, errors, pattern, pair.second, state,
+                        initial_state, method, data, rng, checkpoint);
+      continue;
+    }
+    auto prefix = [&](size_t group) {
+      const size_t end = (group < groups.size()) ? groups[group].first_event
+                                                 : pattern.size();
+      return ErrorPattern(pattern.begin(), pattern.begin() + end);
+    };
+
+    // Resume from the state of the longest cached prefix
+    size_t group = 0;
+    size_t pos = 0;
+    bool resumed = false;
+    for (size_t g = groups.size(); g-- > 0;) {
+      uint_t cached_pos = 0;
+      const auto qreg = cache.find(prefix(g), cached_pos);
+      if (qreg != nullptr && cached_pos <= groups[g].pos) {
+        state.initialize_qreg(circ.num_qubits, *qreg);
+        state.initialize_creg(circ.num_memory, circ.num_registers);
+        group = g;
+        pos = cached_pos;
+        resumed = true;
+        cache_hits++;
+        break;
+      }
+    }
+    if (!resumed)
+      initialize_state(circ, state, initial_state);
+
+    // Release the states required by this pattern
+    for (size_t g = 0; g < groups.size(); ++g) {
+      const auto key = prefix(g);
+      auto &positions = pending[key];
+      positions.pop_front();
+      if (positions.empty()) {
+        pending.erase(key);
+        cache.erase(key);
+      }
+    }
+
+    // Apply the ops up to the end position for a prefix of error events.
+    // If a later pattern requires the state of the prefix it is cached at
+    // the required position, or at the end position if that is earlier.
+    const Operations::Op *ops = circ.ops.data();
+    auto advance = [&](const ErrorPattern &key, size_t end) {
+      auto it = pending.find(key);
+      if (it != pending.end()) {
+        const size_t stop = std::min(it->second.front(), end);
+        if (pos <= stop) {
+          state.apply_ops_range(ops + pos, ops + stop, data, rng);
+          pos = stop;
+          uint_t cached_pos = 0;
+          if (cache.find(key, cached_pos) == nullptr || cached_pos != stop)
+            cache.insert(key, stop, state.qreg());
+        }
+      }
+      state.apply_ops_range(ops + pos, ops + end, data, rng);
+      pos = end;
+    };
+    for (; group < groups.size(); ++group) {
+      advance(prefix(group), groups[group].pos);
+      const auto &noise_ops = groups[group].ops;
+      state.apply_ops_range(noise_ops.data(),
+                            noise_ops.data() + noise_ops.size(), data, rng);
+      pos++;
+    }
+    advance(pattern, meas_pos);
+    measure_sampler(meas_ops, pair.second, state, data, rng);
+  }
+  data.add_metadata("measure_sampling", true);
+  data.add_metadata("sparse_noise_cache_hits", cache_hits);
+  return true;
+}
+
+template <class State_t, class Initstate_t>
+bool QasmController::run_circuit_with_pauli_frames(
+    const Circuit &, const Noise::NoiseModel &,
+    const Noise::NoiseModel::CircuitErrors &, uint_t, State_t &,
+    const Initstate_t &, ExperimentData &, RngEngine &, Checkpoint &) const {
+  return false;
+}
+
+bool QasmController::run_circuit_with_pauli_frames(
+    const Circuit &circ, const Noise::NoiseModel &noise,
+    const Noise::NoiseModel::CircuitErrors &errors, uint_t shots,
+    Stabilizer::State &, const Clifford::Clifford &initial_state,
+    ExperimentData &data, RngEngine &rng, Checkpoint &checkpoint) const {
+  // Adaptive shots and checkpoints require shot by shot execution
+  if (!pauli_frame_simulation_ || shots < 2 || adaptive_shots_ ||
+      checkpoint.enabled() || !initial_state.empty() ||
+      !noise.sparse_sampling_supported(circ, errors) ||
+      !noise.pauli_errors(errors)) {
+    return false;
+  }
+  // The frames of all shots are updated by the same ops, so ops can't
+  // depend on the classical bits of a shot or record the state of a shot
+  for (const auto &op : circ.ops) {
+    if (op.conditional || op.old_conditional)
+      return false;
+    switch (op.type) {
+      case Operations::OpType::gate:
+        if (!Stabilizer::PauliFrame::allowed_gate(op.name))
+          return false;
+        break;
+      case Operations::OpType::measure:
+      case Operations::OpType::reset:
+      case Operations::OpType::barrier:
+      case Operations::OpType::roerror:
+        break;
+      default:
+        return false;
+    }
+  }
+
+  const auto reference =
+      Stabilizer::PauliFrame::reference_sample(circ.ops, circ.num_qubits, rng);
+  const uint_t block_size = std::min(pauli_frame_block_size_, shots);
+  Stabilizer::PauliFrame frame;
+  std::vector<BV::BinaryVector> memory;
+  std::vector<BV::BinaryVector> registers;
+  BV::BinaryVector flips;
+  Noise::NoiseModel::NoiseOps readout_ops;
+
+  uint_t shots_done = 0;
+  while (shots_done < shots) {
+    const uint_t num_shots = std::min(block_size, shots - shots_done);
+    frame.initialize(circ.num_qubits, num_shots, rng);
+    memory.assign(circ.num_memory, BV::BinaryVector(num_shots));
+    registers.assign(circ.num_registers, BV::BinaryVector(num_shots));
+    for (size_t pos = 0; pos < circ.ops.size(); ++pos) {
+      const auto &op = circ.ops[pos];
+      apply_pauli_frame_errors(noise, errors[pos], false, frame, rng);
+      switch (op.type) {
+        case Operations::OpType::gate:
+          frame.apply_gate(op);
+          break;
+        case Operations::OpType::measure:
+          for (size_t j = 0; j < op.qubits.size(); ++j) {
+            frame.apply_measure(op.qubits[j], flips, rng);
+            if (reference[pos][j]) {
+              for (uint64_t n = 0; n < flips.numBlocks(); ++n)
+                flips.block(n) = ~flips.block(n);
+            }
+            if (!op.memory.empty())
+              memory[op.memory[j]] = flips;
+            if (!op.registers.empty())
+              registers[op.registers[j]] = flips;
+          }
+          break;
+        case Operations::OpType::reset:
+          for (const auto qubit : op.qubits)
+            frame.apply_reset(qubit, rng);
+          break;
+        case Operations::OpType::roerror:
+          apply_readout_error(op, memory, registers, num_shots, rng);
+          break;
+        default:
+          break;
+      }
+      apply_pauli_frame_errors(noise, errors[pos], true, frame, rng);
+      if (!errors[pos].readout_errors.empty()) {
+        readout_ops.clear();
+        noise.sample_readout_noise(errors[pos], readout_ops, rng);
+        for (const auto &readout_op : readout_ops)
+          apply_readout_error(readout_op, memory, registers, num_shots, rng);
+      }
+    }
+    add_creg_to_data(memory, registers, num_shots, data);
+    shots_done += num_shots;
+  }
+  data.add_metadata("pauli_frame_simulation", true);
+  return true;
+}
+
+void QasmController::apply_pauli_frame_errors(
+    const Noise::NoiseModel &noise, const Noise::NoiseModel::OpErrors &errors,
+    bool errors_after, Stabilizer::PauliFrame &frame, RngEngine &rng) const {
+  const uint_t shots = frame.num_shots();
+  for (const auto &error : errors.quantum_errors) {
+    const auto &qerror = noise.quantum_error(error);
+    const double prob = qerror.error_probability();
+    if (qerror.errors_after() != errors_after || !(prob > 0.))
+      continue;
+    // The shots with an error are visited in order by skipping a
+    // geometrically distributed number of shots
+    const double log_q = std::log1p(-prob);
+    uint_t shot = 0;
+    while (true) {
+      if (prob < 1.) {
+        const double skip = std::floor(std::log1p(-rng.rand()) / log_q);
+        if (skip >= static_cast<double>(shots - shot))
+          break;
+        shot += static_cast<uint_t>(skip);
+      }
+      if (shot >= shots)
+        break;
+      for (const auto &op : qerror.circuits()[qerror.sample_error(rng)]) {
+        if (!op.qubits.empty())
+          frame.apply_pauli(op.name, error.qubits[op.qubits[0]], shot);
+      }
+      ++shot;
+    }
+  }
+}
+
+template <class State_t, class Initstate_t>
+bool QasmController::run_circuit_with_noise_batched(
+    const Circuit &, const Noise::NoiseModel &,
+    const Noise::NoiseModel::CircuitErrors &, uint_t, State_t &,
+    const Initstate_t &, ExperimentData &, RngEngine &, Checkpoint &) const {
+  return false;
+}
+
+template <typename data_t, class Initstate_t>
+bool QasmController::run_circuit_with_noise_batched(
+    const Circuit &circ, const Noise::NoiseModel &noise,
+    const Noise::NoiseModel::CircuitErrors &errors, uint_t shots,
+    Statevector::State<QV::QubitVector<data_t>> &state,
+    const Initstate_t &initial_state, ExperimentData &data, RngEngine &rng,
+    Checkpoint &checkpoint) const {
+  // Adaptive shots and checkpoints require shot by shot execution, and
+  // pershot snapshots must be recorded in shot order
+  if (batched_shots_ < 2 || shots < 2 ||
+      circ.num_qubits > batched_shots_threshold_ || adaptive_shots_ ||
+      checkpoint.enabled()) {
+    return false;
+  }
+  for (const auto &op : circ.ops) {
+    if (op.type == Operations::OpType::snapshot)
+      return false;
+  }
+
+  // Initial state of every shot
+  initialize_state(circ, state, initial_state);
+  const uint_t dim = state.qreg().size();
+  const std::vector<std::complex<data_t>> init_qreg(
+      state.qreg().data(), state.qreg().data() + dim);
+  const ClassicalRegister init_creg = state.creg();
+
+  // Matrices of the ops that can be applied to every shot of a batch
+  const size_t num_ops = circ.ops.size();
+  std::vector<cvector_t> mats(num_ops);
+  std::vector<char> batched(num_ops);
+  for (size_t pos = 0; pos < num_ops; ++pos)
+    batched[pos] = batched_matrix(circ.ops[pos], mats[pos]);
+
+  const uint_t batch_size = std::min(batched_shots_, shots);
+  QV::BatchedQubitVector<data_t> qregs;
+  std::vector<ClassicalRegister> cregs;
+  std::vector<Noise::NoiseModel::NoiseOps> noise_before(batch_size);
+  std::vector<Noise::NoiseModel::NoiseOps> noise_after(batch_size);
+  std::vector<std::vector<cvector_t>> mats_before(batch_size);
+  std::vector<std::vector<cvector_t>> mats_after(batch_size);
+  std::vector<char> apply_op(batch_size);
+  std::vector<char> in_batch(batch_size);
+  std::vector<uint_t> held_lanes;
+  std::vector<std::complex<data_t>> held_qregs;
+
+  uint_t shots_done = 0;
+  while (shots_done < shots) {
+    const uint_t num_lanes = std::min(batch_size, shots - shots_done);
+    qregs.initialize(circ.num_qubits, num_lanes, init_qreg.data());
+    cregs.assign(num_lanes, init_creg);
+    bool noise_active = true;
+    for (size_t pos = 0; pos < num_ops; ++pos) {
+      const auto &op = circ.ops[pos];
+      if (op.type == Operations::OpType::barrier)
+        continue;
+      // Sample the non-identity errors of the op for each shot. Shots
+      // whose errors are all gates or matrices stay in the batch.
+      bool active = noise_active;
+      uint_t num_applied = 0;
+      for (uint_t lane = 0; lane < num_lanes; ++lane) {
+        active = noise_active;
+        noise_before[lane].clear();
+        noise_after[lane].clear();
+        apply_op[lane] = noise.sample_noise(op, errors[pos], active,
+                                            noise_before[lane],
+                                            noise_after[lane], rng);
+        in_batch[lane] = (batched[pos] || !apply_op[lane]) &&
+                         batched_matrices(noise_before[lane],
+                                          mats_before[lane]) &&
+                         batched_matrices(noise_after[lane], mats_after[lane]);
+        if (in_batch[lane] && apply_op[lane])
+          num_applied++;
+      }
+      noise_active = active;
+
+      // Shots out of the batch are updated one at a time on the single
+      // shot state, and shots of the batch whose op was replaced by its
+      // errors are held out of the batched update of the op
+      held_lanes.clear();
+      held_qregs.clear();
+      for (uint_t lane = 0; lane < num_lanes; ++lane) {
+        if (in_batch[lane]) {
+          apply_lane_matrices(qregs, lane, noise_before[lane],
+                              mats_before[lane]);
+          if (apply_op[lane] || num_applied == 0)
+            continue;
+          held_qregs.resize(held_qregs.size() + dim);
+          qregs.get_lane(lane, held_qregs.data() + held_qregs.size() - dim);
+        } else {
+          qregs.get_lane(lane, state.qreg().data());
+          state.initialize_creg(cregs[lane]);
+          const auto &before = noise_before[lane];
+          const auto &after = noise_after[lane];
+          state.apply_ops_range(before.data(), before.data() + before.size(),
+                                data, rng);
+          if (apply_op[lane])
+            state.apply_ops_range(&op, &op + 1, data, rng);
+          state.apply_ops_range(after.data(), after.data() + after.size(),
+                                data, rng);
+          cregs[lane] = state.creg();
+          held_qregs.insert(held_qregs.end(), state.qreg().data(),
+                            state.qreg().data() + dim);
+        }
+        held_lanes.push_back(lane);
+      }
+      // Apply the op to every shot of the batch and restore the held shots
+      if (num_applied > 0)
+        qregs.apply_matrix(op.qubits, mats[pos]);
+      for (size_t i = 0; i < held_lanes.size(); ++i)
+        qregs.set_lane(held_lanes[i], held_qregs.data() + i * dim);
+      for (uint_t lane = 0; lane < num_lanes; ++lane) {
+        if (in_batch[lane])
+          apply_lane_matrices(qregs, lane, noise_after[lane],
+                              mats_after[lane]);
+      }
+    }
+    for (uint_t lane = 0; lane < num_lanes; ++lane) {
+      state.initialize_creg(cregs[lane]);
+      state.add_creg_to_data(data);
+    }
+    shots_done += num_lanes;
+  }
+  data.add_metadata("batched_shots", batch_size);
+  return true;
+}
+
+bool QasmController::batched_matrix(const Operations::Op &op,
+                                    cvector_t &mat) const {
+  if (op.conditional)
+    return false;
+  switch (op.type) {
+    case Operations::OpType::matrix:
+      if (op.mats.size() != 1)
+        return false;
+      mat = Utils::vectorize_matrix(op.mats[0]);
+      return true;
+    case Operations::OpType::gate:
+      if (op.name == "u1") {
+        mat = Utils::VMatrix::u1(op.params[0]);
+      } else if (op.name == "u2") {
+        mat = Utils::VMatrix::u2(op.params[0], op.params[1]);
+      } else if (op.name == "u3") {
+        mat = Utils::VMatrix::u3(op.params[0], op.params[1], op.params[2]);
+      } else if (Utils::VMatrix::allowed_name(op.name)) {
+        mat = Utils::VMatrix::from_name(op.name);
+      } else {
+        return false;
+      }
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool QasmController::batched_matrices(const Noise::NoiseModel::NoiseOps &ops,
+                                      std::vector<cvector_t> &mats) const {
+  mats.resize(ops.size());
+  for (size_t i = 0; i < ops.size(); ++i) {
+    if (ops[i].type == Operations::OpType::gate && ops[i].name == "id") {
+      mats[i].clear();
+    } else if (!batched_matrix(ops[i], mats[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename data_t>
+void QasmController::apply_lane_matrices(
+    QV::BatchedQubitVector<data_t> &qregs, uint_t lane,
+    const Noise::NoiseModel::NoiseOps &ops,
+    const std::vector<cvector_t> &mats) const {
+  for (size_t i = 0; i < ops.size(); ++i) {
+    if (!mats[i].empty())
+      qregs.apply_lane_matrix(lane, ops[i].qubits, mats[i]);
+  }
+}
+
+template <typename Lambda>
+void QasmController::run_shots(uint_t shots, ExperimentData &data,
+                               RngEngine &rng, Checkpoint &checkpoint,
+                               Lambda &&run_shot) const {
+  uint_t shots_done = 0;
+  if (checkpoint.exists()) {
+    // Resume from the completed shots of an earlier execution
+    const json_t header = checkpoint.load_header();
+    if (header["type"] == "shots") {
+      shots_done = header["shots_done"].get<uint_t>();
+      data.load_checkpoint(header["data"]);
+      rng.set_state(header["rng"].get<std::string>());
+    }
+  }
+  // Without adaptive shots all shots are executed as a single batch.
+  // Adaptive shots of several shot threads are batched by execute_shots.
+  const bool adaptive = adaptive_shots_ && parallel_shots_ <= 1;
+  const uint_t batch_size = (adaptive) ? adaptive_shots_batch_size_ : shots;
+  std::pair<bool, double> error(false, 0.);
+  bool converged = false;
+  while (shots_done < shots && !converged) {
+    const uint_t batch_end = std::min(shots, shots_done + batch_size);
+    while (shots_done < batch_end) {
+      run_shot();
+      ++shots_done;
+      if (checkpoint.due()) {
+        json_t header;
+        header["type"] = "shots";
+        header["shots_done"] = shots_done;
+        header["data"] = data.checkpoint();
+        header["rng"] = rng.state();
+        checkpoint.save(header);
+      }
+    }
+    if (adaptive)
+      converged = adaptive_shots_converged(data, shots_done, error);
+  }
+  if (adaptive)
+    add_adaptive_shots_metadata(data, shots_done, converged, error);
+}
+
+ExperimentData QasmController::execute_shots(const Circuit &circ,
+                                             const Noise::NoiseModel &noise,
+                                             const json_t &config,
+                                             uint_t experiment) const {
+  if (!adaptive_shots_ || parallel_shots_ <= 1)
+    return Base::Controller::execute_shots(circ, noise, config, experiment);
+  ExperimentData data;
+  data.set_config(config);
+  // The seeds of the batches after the first are drawn from the circuit seed
+  RngEngine rng;
+  rng.set_seed(circ.seed);
+  uint_t seed = circ.seed;
+  uint_t shots_done = 0;
+  std::pair<bool, double> error(false, 0.);
+  bool converged = false;
+  while (shots_done < circ.shots && !converged) {
+    const uint_t batch_size =
+        std::min(circ.shots - shots_done, adaptive_shots_batch_size_);
+    data.combine(run_shot_threads(circ, noise, config, experiment, batch_size,
+                                  seed, shots_done));
+    shots_done += batch_size;
+    converged = adaptive_shots_converged(data, shots_done, error);
+    seed = rng.rand_int(uint_t(0), std::numeric_limits<uint_t>::max() >> 1);
+  }
+  add_adaptive_shots_metadata(data, shots_done, converged, error);
+  return data;
+}
+
+bool QasmController::adaptive_shots_converged(
+    const ExperimentData &data, uint_t shots,
+    std::pair<bool, double> &error) const {
+  error = adaptive_shots_error(data, shots);
+  return shots >= adaptive_shots_min_shots_ && error.first &&
+         error.second <= adaptive_shots_target_error_;
+}
+
+void QasmController::add_adaptive_shots_metadata(
+    ExperimentData &data, uint_t shots, bool converged,
+    const std::pair<bool, double> &error) const {
+  json_t metadata;
+  metadata["shots"] = shots;
+  metadata["converged"] = converged;
+  if (error.first) {
+    metadata["standard_error"] = error.second;
+  }
+  data.add_metadata("adaptive_shots", metadata);
+}
+
+std::pair<bool, double> QasmController::adaptive_shots_error(
+    const ExperimentData &data, uint_t shots) const {
+  bool tracked = false;
+  double max_error = 0.;
+  switch (adaptive_shots_observable_) {
+    case AdaptiveObservable::counts: {
+      // Agresti-Coull standard error of each outcome probability, which
+      // unlike the binomial standard error is not zero for outcomes with
+      // an estimated probability of 0 or 1. Outcomes that have not been
+      // observed are tracked as an outcome with a count of 0.
+      if (shots == 0)
+        break;
+      const double n = shots + 4.;
+      auto count_error = [n](uint_t count) {
+        const double p = (count + 2.) / n;
+        return std::sqrt(p * (1. - p) / n);
+      };
+      max_error = count_error(0);
+      for (const auto &count : data.counts_.values())
+        max_error = std::max(max_error, count_error(count));
+      tracked = true;
+      break;
+    }
+    case AdaptiveObservable::expectation_value: {
+      // Standard error of the mean for snapshots that store their variance
+      auto it = data.average_complex_snapshots_.find("expectation_value");
+      if (it == data.average_complex_snapshots_.end())
+        break;
+      for (const auto &label : it->second.data()) {
+        for (const auto &memory : label.second) {
+          const auto &avg = memory.second;
+          if (!avg.has_variance() || avg.size() < 2)
+            continue;
+          const double var = std::max(0., std::real(avg.variance()));
+          max_error = std::max(max_error, std::sqrt(var / avg.size()));
+          tracked = true;
+        }
+      }
+      break;
+    }
+  }
+  return std::make_pair(tracked, max_error);
 }
 
 template <class State_t, class Initstate_t>
@@ -863,7 +2178,8 @@ void QasmController::run_circuit_without_noise(const Circuit &circ,
                                                const Initstate_t &initial_state,
                                                const Method method,
                                                ExperimentData &data,
-                                               RngEngine &rng) const {
+                                               RngEngine &rng,
+                                               Checkpoint &checkpoint) const {
   // Optimize circuit for state type
   Circuit opt_circ = circ;
   if (opt_circ.num_qubits > circuit_opt_ideal_threshold_) {
@@ -875,8 +2191,15 @@ void QasmController::run_circuit_without_noise(const Circuit &circ,
   if (check.first == false) {
     // Perform standard execution if we cannot apply the
     // measurement sampling optimization
-    while (shots-- > 0) {
-      run_single_shot(opt_circ, state, initial_state, data, rng);
+    if (shots == 1) {
+      // A single shot may be checkpointed during execution of the circuit
+      apply_ops_checkpoint(opt_circ, opt_circ.ops, state, initial_state, data,
+                           rng, checkpoint);
+      state.add_creg_to_data(data);
+    } else {
+      run_shots(shots, data, rng, checkpoint, [&]() {
+        run_single_shot(opt_circ, state, initial_state, data, rng);
+      });
     }
   } else {
     // Implement measure sampler
@@ -885,8 +2208,8 @@ void QasmController::run_circuit_without_noise(const Circuit &circ,
     // Run circuit instructions before first measure
     std::vector<Operations::Op> ops(opt_circ.ops.begin(),
                                     opt_circ.ops.begin() + pos);
-    initialize_state(opt_circ, state, initial_state);
-    state.apply_ops(ops, data, rng);
+    apply_ops_checkpoint(opt_circ, ops, state, initial_state, data, rng,
+                         checkpoint);
 
     // Get measurement operations and set of measured qubits
     ops = std::vector<Operations::Op>(opt_circ.ops.begin() + pos,
@@ -897,6 +2220,61 @@ void QasmController::run_circuit_without_noise(const Circuit &circ,
   }
 }
 
+template <class State_t, class Initstate_t>
+void QasmController::apply_ops_checkpoint(
+    const Circuit &circ, const std::vector<Operations::Op> &ops,
+    State_t &state, const Initstate_t &initial_state, ExperimentData &data,
+    RngEngine &rng, Checkpoint &) const {
+  // Checkpointing during a circuit is not supported for this state type
+  initialize_state(circ, state, initial_state);
+  state.apply_ops(ops, data, rng);
+}
+
+template <typename data_t, class Initstate_t>
+void QasmController::apply_ops_checkpoint(
+    const Circuit &circ, const std::vector<Operations::Op> &ops,
+    Statevector::State<QV::QubitVector<data_t>> &state,
+    const Initstate_t &initial_state, ExperimentData &data, RngEngine &rng,
+    Checkpoint &checkpoint) const {
+  if (!checkpoint.enabled()) {
+    initialize_state(circ, state, initial_state);
+    state.apply_ops(ops, data, rng);
+    return;
+  }
+  // Resume from a partially executed circuit if one was saved
+  size_t pos = 0;
+  json_t header;
+  if (checkpoint.exists())
+    header = checkpoint.load_header();
+  if (header.is_object() && header["type"] == "ops") {
+    pos = header["op_index"].get<size_t>();
+    QV::QubitVector<data_t> qreg(circ.num_qubits);
+    checkpoint.load_blob(qreg.data(), qreg.size() * sizeof(*qreg.data()));
+    state.initialize_qreg(circ.num_qubits, qreg);
+    ClassicalRegister creg;
+    creg.load_checkpoint(header["creg"]);
+    state.initialize_creg(creg);
+    data.load_checkpoint(header["data"]);
+    rng.set_state(header["rng"].get<std::string>());
+  } else {
+    initialize_state(circ, state, initial_state);
+  }
+  // Apply ops one at a time so that a checkpoint can be saved between them
+  for (; pos < ops.size(); ++pos) {
+    if (checkpoint.due()) {
+      header = json_t();
+      header["type"] = "ops";
+      header["op_index"] = pos;
+      header["creg"] = state.creg().checkpoint();
+      header["data"] = data.checkpoint();
+      header["rng"] = rng.state();
+      const auto &qreg = state.qreg();
+      checkpoint.save(header, qreg.data(), qreg.size() * sizeof(*qreg.data()));
+    }
+    state.apply_ops_range(ops.data() + pos, ops.data() + pos + 1, data, rng);
+  }
+}
+
 //-------------------------------------------------------------------------
 // Measure sampling optimization
 //-------------------------------------------------------------------------
@@ -918,7 +2296,8 @@ std::pair<bool, size_t> QasmController::check_measure_sampling_opt(
       if (type == Operations::OpType::reset ||
           type == Operations::OpType::initialize ||
           type == Operations::OpType::kraus ||
-          type == Operations::OpType::superop) {
+          type == Operations::OpType::superop ||
+          type == Operations::OpType::thermal_relaxation) {
         return std::make_pair(false, 0);
       }
     }
@@ -973,8 +2352,6 @@ void QasmController::measure_sampler(
   sort(meas_qubits.begin(), meas_qubits.end());
   meas_qubits.erase(unique(meas_qubits.begin(), meas_qubits.end()),
                     meas_qubits.end());
-  // Generate the samples
-  auto all_samples = state.sample_measure(meas_qubits, shots, rng);
 
   // Make qubit map of position in vector of measured qubits
   std::unordered_map<uint_t, uint_t> qubit_map;
@@ -997,35 +2374,262 @@ void QasmController::measure_sampler(
   // Convert opts to circuit so we can get the needed creg sizes
   // NB: this function could probably be moved somewhere else like Utils or Ops
   Circuit meas_circ(meas_roerror_ops);
-  ClassicalRegister creg;
-  while (!all_samples.empty()) {
-    auto sample = all_samples.back();
-    creg.initialize(meas_circ.num_memory, meas_circ.num_registers);
+  if (shots == 0)
+    return;
+
+  const bool counts_only = !data.return_memory_ && !data.return_register_ &&
+                           meas_circ.num_memory <= 64;
+  if (counts_only && meas_circ.num_memory == 0)
+    return;
+
+  // If only counts are returned the exact distribution of memory values
+  // can be computed when every readout error acts on measured bits, and
+  // the counts drawn from it in a single multinomial sample. The
+  // distribution is exponential in the number of measured qubits.
+  if (counts_only && probabilities_with_readout_ &&
+      meas_qubits.size() <= probabilities_with_readout_threshold_) {
+    bool measured_bits = true;
+    for (const auto &op : roerror_ops)
+      for (const auto &bit : op.memory)
+        measured_bits &= (memory_map.find(bit) != memory_map.end());
+    rvector_t probs;
+    if (measured_bits && measure_probs(state, meas_qubits, probs)) {
+      reg_t bits;
+      for (const auto &pair : memory_map)
+        bits.push_back(pair.first);
+      std::sort(bits.begin(), bits.end());
+      probs = readout_distribution(probs, memory_map, roerror_ops, bits);
+      const auto counts = rng.rand_multinomial(shots, probs);
+      json_t js_probs = json_t::object();
+      for (uint_t i = 0; i < probs.size(); ++i) {
+        if (!(probs[i] > 0.))
+          continue;
+        uint_t memory_val = 0;
+        for (size_t j = 0; j < bits.size(); ++j) {
+          if ((i >> j) & 1)
+            memory_val |= (1ULL << bits[j]);
+        }
+        const std::string memory_hex =
+            Utils::bin2hex(Utils::int2bin(memory_val, meas_circ.num_memory));
+        js_probs[memory_hex] = probs[i];
+        if (counts[i] > 0)
+          data.add_memory_count(reg_t({memory_val}), meas_circ.num_memory,
+                                counts[i]);
+      }
+      data.add_additional_data("probabilities_with_readout", js_probs);
+      return;
+    }
+  }
+
+  // Generate the samples
+  auto all_samples = state.sample_measure(meas_qubits, shots, rng);
+
+  // If only counts are returned the readout errors are applied to the
+  // histogram of memory values
+  if (counts_only) {
+    std::map<uint_t, uint_t> counts;
+    for (const auto &sample : all_samples) {
+      uint_t memory_val = 0;
+      for (const auto &pair : memory_map) {
+        if (sample[pair.second])
+          memory_val |= (1ULL << pair.first);
+      }
+      counts[memory_val]++;
+    }
+    all_samples.clear();
+    for (const Operations::Op &roerror : roerror_ops) {
+      apply_readout_error(roerror, counts, rng);
+    }
+    for (const auto &pair : counts) {
+      data.add_memory_count(reg_t({pair.first}), meas_circ.num_memory,
+                            pair.second);
+    }
+    return;
+  }
 
-    // process memory bit measurements
+  // Otherwise the samples are stored as a bit vector for each memory and
+  // register bit indexed by shot
+  std::vector<BV::BinaryVector> memory(meas_circ.num_memory,
+                                       BV::BinaryVector(shots));
+  std::vector<BV::BinaryVector> registers(meas_circ.num_registers,
+                                          BV::BinaryVector(shots));
+  for (uint_t shot = 0; shot < shots; ++shot) {
+    const auto &sample = all_samples[shot];
     for (const auto &pair : memory_map) {
-      creg.store_measure(reg_t({sample[pair.second]}), reg_t({pair.first}),
-                         reg_t());
+      if (sample[pair.second])
+        memory[pair.first].set1(shot);
     }
-    // process register bit measurements
     for (const auto &pair : register_map) {
-      creg.store_measure(reg_t({sample[pair.second]}), reg_t(),
-                         reg_t({pair.first}));
+      if (sample[pair.second])
+        registers[pair.first].set1(shot);
     }
+  }
+  all_samples.clear();
 
-    // process read out errors for memory and registers
-    for (const Operations::Op &roerror : roerror_ops) {
-      creg.apply_roerror(roerror, rng);
+  // process read out errors for memory and registers
+  for (const Operations::Op &roerror : roerror_ops) {
+    apply_readout_error(roerror, memory, registers, shots, rng);
+  }
+  add_creg_to_data(memory, registers, shots, data);
+}
+
+template <class statevec_t>
+bool QasmController::measure_probs(
+    const Statevector::State<statevec_t> &state, const reg_t &qubits,
+    rvector_t &probs) const {
+  probs = state.qreg().probabilities(qubits);
+  return true;
+}
+
+template <class densmat_t>
+bool QasmController::measure_probs(
+    const DensityMatrix::State<densmat_t> &state, const reg_t &qubits,
+    rvector_t &probs) const {
+  probs = state.qreg().probabilities(qubits);
+  return true;
+}
+
+rvector_t QasmController::readout_distribution(
+    const rvector_t &probs,
+    const std::unordered_map<uint_t, uint_t> &memory_map,
+    const std::vector<Operations::Op> &roerror_ops,
+    const reg_t &bits) const {
+  std::unordered_map<uint_t, uint_t> bit_pos;
+  for (size_t j = 0; j < bits.size(); ++j)
+    bit_pos[bits[j]] = j;
+
+  // Distribution of the memory values before readout errors
+  rvector_t dist(1ULL << bits.size(), 0.);
+  for (uint_t i = 0; i < probs.size(); ++i) {
+    if (!(probs[i] > 0.))
+      continue;
+    uint_t index = 0;
+    for (const auto &pair : memory_map) {
+      if ((i >> pair.second) & 1)
+        index |= (1ULL << bit_pos[pair.first]);
     }
+    dist[index] += probs[i];
+  }
 
-    auto memory = creg.memory_hex();
-    data.add_memory_count(memory);
-    data.add_pershot_memory(memory);
+  // Apply the confusion matrix of each readout error op to the
+  // distribution of its memory bits
+  rvector_t cache;
+  reg_t offsets;
+  for (const auto &op : roerror_ops) {
+    const uint_t dim = 1ULL << op.memory.size();
+    uint_t mask = 0;
+    offsets.assign(dim, 0);
+    for (size_t j = 0; j < op.memory.size(); ++j) {
+      const uint_t bit = 1ULL << bit_pos[op.memory[j]];
+      mask |= bit;
+      for (uint_t val = 0; val < dim; ++val) {
+        if ((val >> j) & 1)
+          offsets[val] |= bit;
+      }
+    }
+    cache.resize(dim);
+    for (uint_t i = 0; i < dist.size(); ++i) {
+      if (i & mask)
+        continue;
+      for (uint_t val = 0; val < dim; ++val) {
+        cache[val] = dist[i | offsets[val]];
+        dist[i | offsets[val]] = 0.;
+      }
+      for (uint_t val = 0; val < dim; ++val) {
+        if (!(cache[val] > 0.))
+          continue;
+        const auto &row = op.probs[val];
+        for (uint_t outcome = 0; outcome < dim; ++outcome)
+          dist[i | offsets[outcome]] += cache[val] * row[outcome];
+      }
+    }
+  }
+  return dist;
+}
 
-    data.add_pershot_register(creg.register_hex());
+void QasmController::apply_readout_error(
+    const Operations::Op &op, std::vector<BV::BinaryVector> &memory,
+    std::vector<BV::BinaryVector> &registers, uint_t shots,
+    RngEngine &rng) const {
+  // Errors are sampled from the memory bits of each shot as in
+  // ClassicalRegister::apply_roerror
+  const bool use_tables =
+      (op.probs_tables && op.probs_tables->size() == op.probs.size());
+  for (uint_t shot = 0; shot < shots; ++shot) {
+    uint_t memory_val = 0;
+    for (size_t j = 0; j < op.memory.size(); ++j) {
+      if (memory[op.memory[j]][shot])
+        memory_val |= (1ULL << j);
+    }
+    const uint_t outcome = (use_tables)
+                               ? rng.rand_int((*op.probs_tables)[memory_val])
+                               : rng.rand_int(op.probs[memory_val]);
+    for (size_t j = 0; j < op.memory.size(); ++j)
+      memory[op.memory[j]].setValue((outcome >> j) & 1, shot);
+    for (size_t j = 0; j < op.registers.size(); ++j)
+      registers[op.registers[j]].setValue((outcome >> j) & 1, shot);
+  }
+}
 
-    // pop off processed sample
-    all_samples.pop_back();
+void QasmController::apply_readout_error(const Operations::Op &op,
+                                         std::map<uint_t, uint_t> &counts,
+                                         RngEngine &rng) const {
+  uint_t mask = 0;
+  for (const auto &bit : op.memory)
+    mask |= (1ULL << bit);
+  std::map<uint_t, uint_t> noisy_counts;
+  for (const auto &pair : counts) {
+    uint_t memory_val = 0;
+    for (size_t j = 0; j < op.memory.size(); ++j) {
+      if ((pair.first >> op.memory[j]) & 1)
+        memory_val |= (1ULL << j);
+    }
+    const auto outcomes = rng.rand_multinomial(pair.second,
+                                               op.probs[memory_val]);
+    for (uint_t outcome = 0; outcome < outcomes.size(); ++outcome) {
+      if (outcomes[outcome] == 0)
+        continue;
+      uint_t noisy_val = pair.first & ~mask;
+      for (size_t j = 0; j < op.memory.size(); ++j) {
+        if ((outcome >> j) & 1)
+          noisy_val |= (1ULL << op.memory[j]);
+      }
+      noisy_counts[noisy_val] += outcomes[outcome];
+    }
+  }
+  counts = std::move(noisy_counts);
+}
+
+void QasmController::add_creg_to_data(
+    const std::vector<BV::BinaryVector> &memory,
+    const std::vector<BV::BinaryVector> &registers, uint_t shots,
+    ExperimentData &data) const {
+  // Return the bit-string of the classical bits of a shot
+  auto shot_bits = [](const std::vector<BV::BinaryVector> &bits,
+                      uint_t shot) {
+    std::string bin(bits.size(), '0');
+    for (size_t j = 0; j < bits.size(); ++j) {
+      if (bits[j][shot])
+        bin[bits.size() - 1 - j] = '1';
+    }
+    return bin;
+  };
+  // Counts and per-shot memory are stored from the 64-bit words of the
+  // memory bits of a shot
+  reg_t words((memory.size() + 63) / 64);
+  for (uint_t shot = 0; shot < shots; ++shot) {
+    if (!memory.empty()) {
+      std::fill(words.begin(), words.end(), 0);
+      for (size_t j = 0; j < memory.size(); ++j) {
+        if (memory[j][shot])
+          words[j / 64] |= (1ULL << (j % 64));
+      }
+      data.add_memory_count(words, memory.size());
+      data.add_pershot_memory(words, memory.size());
+    }
+    if (!registers.empty())
+      data.add_pershot_register(Utils::bin2hex(shot_bits(registers, shot)));
+    data.end_shot();
   }
 }
 
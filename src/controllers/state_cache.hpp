@@ -0,0 +1,142 @@
+/**
+ * This code is part of Qiskit.
+ *
+ * (C) Copyright IBM 2018, 2019, 2020.
+ *
+ * This code is licensed under the Apache License, Version 2.0. You may
+ * obtain a copy of this license in the LICENSE.txt file in the root directory
+ * of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Any modifications or derivative works of this code must retain this
+ * copyright notice, and modified files need to carry a notice indicating
+ * that they have been altered from the originals.
+ */
+
+#ifndef _aer_controllers_state_cache_hpp_
+#define _aer_controllers_state_cache_hpp_
+
+#include <list>
+#include <map>
+
+#include "framework/types.hpp"
+
+namespace AER {
+namespace Simulator {
+
+//=========================================================================
+// StateCache class
+//=========================================================================
+
+// A least recently used cache of copies of simulator registers, bounded by
+// the memory of the stored registers. Each register is stored with the
+// position of the circuit at which it was copied.
+//
+// The register type must be constructible from a number of qubits and
+// provide the num_qubits, size, data and initialize_from_data methods of
+// QV::QubitVector.
+
+template <class key_t, class qreg_t>
+class StateCache {
+
+public:
+
+  explicit StateCache(size_t max_bytes) : max_bytes_(max_bytes) {}
+
+  // Return the cached register of a key and mark it as the most recently
+  // used, or nullptr if the key isn't cached. If found pos is set to the
+  // circuit position of the register.
+  const qreg_t *find(const key_t &key, uint_t &pos);
+
+  // Store a copy of a register for a key, replacing any register already
+  // stored for the key. Least recently used registers are evicted until
+  // the copy fits, and it isn't stored if it is larger than the cache.
+  void insert(const key_t &key, uint_t pos, const qreg_t &qreg);
+
+  // Remove the register of a key if it is cached
+  void erase(const key_t &key);
+
+  // Return the number of cached registers
+  size_t size() const {return entries_.size();}
+
+protected:
+
+  struct Entry {
+    Entry(const key_t &key_, uint_t num_qubits) : key(key_), qreg(num_qubits) {}
+    key_t key;
+    uint_t pos = 0;
+    qreg_t qreg;
+  };
+
+  // Return the memory of a register in bytes
+  static size_t bytes(const qreg_t &qreg) {
+    return qreg.size() * sizeof(*qreg.data());
+  }
+
+  // Cached registers with the most recently used first
+  std::list<Entry> entries_;
+  std::map<key_t, typename std::list<Entry>::iterator> index_;
+
+  size_t max_bytes_;
+  size_t bytes_ = 0;
+};
+
+//=========================================================================
+// Implementation
+//=========================================================================
+
+template <class key_t, class qreg_t>
+const qreg_t *StateCache<key_t, qreg_t>::find(const key_t &key, uint_t &pos) {
+  auto it = index_.find(key);
+  if (it == index_.end())
+    return nullptr;
+  entries_.splice(entries_.begin(), entries_, it->second);
+  pos = it->second->pos;
+  return &it->second->qreg;
+}
+
+template <class key_t, class qreg_t>
+void StateCache<key_t, qreg_t>::insert(const key_t &key, uint_t pos,
+                                       const qreg_t &qreg) {
+  const size_t required = bytes(qreg);
+  auto it = index_.find(key);
+  if (it != index_.end() &&
+      it->second->qreg.num_qubits() == qreg.num_qubits()) {
+    // Reuse the register already stored for the key
+    auto entry = it->second;
+    entries_.splice(entries_.begin(), entries_, entry);
+    entry->pos = pos;
+    entry->qreg.initialize_from_data(qreg.data(), qreg.size());
+    return;
+  }
+  erase(key);
+  if (required > max_bytes_)
+    return;
+  while (bytes_ + required > max_bytes_) {
+    bytes_ -= bytes(entries_.back().qreg);
+    index_.erase(entries_.back().key);
+    entries_.pop_back();
+  }
+  entries_.emplace_front(key, qreg.num_qubits());
+  auto entry = entries_.begin();
+  entry->pos = pos;
+  entry->qreg.initialize_from_data(qreg.data(), qreg.size());
+  index_[key] = entry;
+  bytes_ += required;
+}
+
+template <class key_t, class qreg_t>
+void StateCache<key_t, qreg_t>::erase(const key_t &key) {
+  auto it = index_.find(key);
+  if (it == index_.end())
+    return;
+  bytes_ -= bytes(it->second->qreg);
+  entries_.erase(it->second);
+  index_.erase(it);
+}
+
+//-------------------------------------------------------------------------
+} // end namespace Simulator
+//-------------------------------------------------------------------------
+} // end namespace AER
+//-------------------------------------------------------------------------
+#endif
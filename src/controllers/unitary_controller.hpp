@@ -297,7 +297,7 @@ ExperimentData UnitaryController::run_circuit_helper(
   state.add_creg_to_data(data);
 
   // Add final state unitary to the data
-  data.add_additional_data("unitary", state.qreg().matrix());
+  data.add_additional_data("unitary", state.qreg().move_to_matrix());
 
   return data;
 }
@@ -0,0 +1,230 @@
+/**
+ * This code is part of Qiskit.
+ *
+ * (C) Copyright IBM 2018, 2019, 2020.
+ *
+ * This code is licensed under the Apache License, Version 2.0. You may
+ * obtain a copy of this license in the LICENSE.txt file in the root directory
+ * of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Any modifications or derivative works of this code must retain this
+ * copyright notice, and modified files need to carry a notice indicating
+ * that they have been altered from the originals.
+ */
+
+#ifndef _aer_framework_checkpoint_hpp_
+#define _aer_framework_checkpoint_hpp_
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "framework/json.hpp"
+#include "framework/types.hpp"
+
+namespace AER {
+
+//============================================================================
+// Checkpoint file for resuming interrupted simulations
+//============================================================================
+
+/**************************************************************************
+ * A checkpoint file stores a JSON header encoded as CBOR followed by an
+ * optional raw binary blob (for example the amplitudes of a statevector).
+ *
+ * File layout:
+ *  - 8 byte magic string "AERCKPT1"
+ *  - uint64 header size in bytes, followed by the CBOR header
+ *  - uint64 blob size in bytes, followed by the blob
+ *
+ * Sizes and blob data are stored in the native byte order so checkpoint
+ * files are only intended to be resumed on the machine that wrote them.
+ * A checkpoint is first written to a temporary file and then renamed so
+ * that an interrupted write never corrupts the previous checkpoint.
+ **************************************************************************/
+
+class Checkpoint {
+public:
+  using myclock_t = std::chrono::steady_clock;
+
+  // Construct a disabled checkpoint
+  Checkpoint() = default;
+
+  // Construct a checkpoint stored in file `name` of `directory`.
+  // A new checkpoint is due every `period` seconds. The `id` JSON is
+  // stored with each checkpoint and loading a checkpoint with a
+  // different id raises an exception.
+  Checkpoint(const std::string &directory, const std::string &name,
+             double period, const json_t &id = json_t());
+
+  // Return true if checkpointing is enabled
+  bool enabled() const {return !path_.empty();}
+
+  // Return the checkpoint file path
+  const std::string &path() const {return path_;}
+
+  // Return true if a checkpoint file exists
+  bool exists() const;
+
+  // Return true if `period` seconds have elapsed since construction
+  // or the last call to `save`
+  bool due() const;
+
+  // Write a checkpoint file containing the header and an optional blob
+  void save(const json_t &header, const void *blob = nullptr,
+            size_t blob_size = 0);
+
+  // Load the header of the checkpoint file. An exception is raised if the
+  // checkpoint was saved with a different id.
+  json_t load_header() const;
+
+  // Load the blob of the checkpoint file into a buffer of `blob_size` bytes.
+  // An exception is raised if the stored blob has a different size.
+  void load_blob(void *blob, size_t blob_size) const;
+
+  // Remove the checkpoint file if it exists
+  void remove() const;
+
+private:
+  static const std::string magic_;
+
+  // Open the checkpoint file and read the header bytes. The stream is
+  // left positioned at the blob size field.
+  std::vector<uint8_t> read_header(std::ifstream &file) const;
+
+  std::string path_;
+  json_t id_;
+  double period_ = 0;
+  myclock_t::time_point last_save_ = myclock_t::now();
+};
+
+//============================================================================
+// Implementations
+//============================================================================
+
+const std::string Checkpoint::magic_ = "AERCKPT1";
+
+Checkpoint::Checkpoint(const std::string &directory, const std::string &name,
+                       double period, const json_t &id)
+    : id_(id), period_(period) {
+  if (!directory.empty()) {
+    path_ = directory;
+    if (path_.back() != '/')
+      path_ += '/';
+    path_ += name;
+  }
+}
+
+bool Checkpoint::exists() const {
+  if (!enabled())
+    return false;
+  std::ifstream file(path_, std::ios::binary);
+  return file.good();
+}
+
+bool Checkpoint::due() const {
+  if (!enabled())
+    return false;
+  const double elapsed =
+      std::chrono::duration<double>(myclock_t::now() - last_save_).count();
+  return elapsed >= period_;
+}
+
+void Checkpoint::save(const json_t &header, const void *blob,
+                      size_t blob_size) {
+  if (!enabled())
+    return;
+  json_t js = header;
+  js["id"] = id_;
+  const std::vector<uint8_t> cbor = json_t::to_cbor(js);
+  const uint64_t header_size = cbor.size();
+  const uint64_t data_size = blob_size;
+
+  const std::string tmp_path = path_ + ".tmp";
+  {
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      throw std::runtime_error("Checkpoint: unable to open file \"" +
+                               tmp_path + "\" for writing.");
+    }
+    file.write(magic_.data(), magic_.size());
+    file.write(reinterpret_cast<const char *>(&header_size),
+               sizeof(header_size));
+    file.write(reinterpret_cast<const char *>(cbor.data()), cbor.size());
+    file.write(reinterpret_cast<const char *>(&data_size), sizeof(data_size));
+    if (blob_size > 0)
+      file.write(static_cast<const char *>(blob), blob_size);
+    if (!file) {
+      throw std::runtime_error("Checkpoint: failed to write file \"" +
+                               tmp_path + "\".");
+    }
+  }
+  if (std::rename(tmp_path.c_str(), path_.c_str()) != 0) {
+    throw std::runtime_error("Checkpoint: unable to replace file \"" + path_ +
+                             "\".");
+  }
+  last_save_ = myclock_t::now();
+}
+
+std::vector<uint8_t> Checkpoint::read_header(std::ifstream &file) const {
+  file.open(path_, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error("Checkpoint: unable to open file \"" + path_ +
+                             "\".");
+  }
+  std::string magic(magic_.size(), '\0');
+  file.read(&magic[0], magic.size());
+  uint64_t header_size = 0;
+  file.read(reinterpret_cast<char *>(&header_size), sizeof(header_size));
+  if (!file || magic != magic_) {
+    throw std::runtime_error("Checkpoint: invalid checkpoint file \"" + path_ +
+                             "\".");
+  }
+  std::vector<uint8_t> cbor(header_size);
+  file.read(reinterpret_cast<char *>(cbor.data()), header_size);
+  if (!file) {
+    throw std::runtime_error("Checkpoint: truncated checkpoint file \"" +
+                             path_ + "\".");
+  }
+  return cbor;
+}
+
+json_t Checkpoint::load_header() const {
+  std::ifstream file;
+  json_t header = json_t::from_cbor(read_header(file));
+  if (header["id"] != id_) {
+    throw std::runtime_error("Checkpoint: checkpoint file \"" + path_ +
+                             "\" was saved for a different experiment.");
+  }
+  return header;
+}
+
+void Checkpoint::load_blob(void *blob, size_t blob_size) const {
+  std::ifstream file;
+  read_header(file);
+  uint64_t data_size = 0;
+  file.read(reinterpret_cast<char *>(&data_size), sizeof(data_size));
+  if (!file || data_size != blob_size) {
+    throw std::runtime_error("Checkpoint: stored data in \"" + path_ +
+                             "\" does not match the expected size.");
+  }
+  file.read(static_cast<char *>(blob), blob_size);
+  if (!file) {
+    throw std::runtime_error("Checkpoint: truncated checkpoint file \"" +
+                             path_ + "\".");
+  }
+}
+
+void Checkpoint::remove() const {
+  if (exists())
+    std::remove(path_.c_str());
+}
+
+//------------------------------------------------------------------------------
+} // end namespace AER
+//------------------------------------------------------------------------------
+#endif
@@ -55,6 +55,11 @@ public:
   Circuit(const json_t &circ);
   Circuit(const json_t &circ, const json_t &qobj_config);
 
+  // Construct a circuit from its already converted instructions and the
+  // JSON of the experiment without the content of its instructions
+  Circuit(std::vector<Op> &&_ops, const json_t &circ,
+          const json_t &qobj_config);
+
   // Automatically set the number of qubits, memory, registers based on ops
   void set_sizes();
 
@@ -84,6 +89,9 @@ public:
 
 private:
   Operations::OpSet opset_;  // Set of operation types contained in circuit
+
+  // Load the experiment config and header for the circuit ops
+  void load_experiment(const json_t &circ, const json_t &qobj_config);
 };
 
 // Json conversion function
@@ -123,24 +131,41 @@ Circuit::Circuit(const std::vector<Op> &_ops) : Circuit() {
 Circuit::Circuit(const json_t &circ) : Circuit(circ, json_t()) {}
 
 Circuit::Circuit(const json_t &circ, const json_t &qobj_config) : Circuit() {
-
-  // Get config
-  json_t config = qobj_config;
-  if (JSON::check_key("config", circ)) {
-    for (auto it = circ["config"].cbegin(); it != circ["config"].cend();
-         ++it) {
-      config[it.key()] = it.value(); // overwrite circuit level config values
-    }
-  }
   // Load instructions
   if (JSON::check_key("instructions", circ) == false) {
     throw std::invalid_argument("Invalid Qobj experiment: no \"instructions\" field.");
   }
   ops.clear(); // remove any current operations
   const json_t &jops = circ["instructions"];
-  for(auto jop: jops){
+  ops.reserve(jops.size());
+  for(const auto &jop: jops){
     ops.emplace_back(Operations::json_to_op(jop));
   }
+  load_experiment(circ, qobj_config);
+}
+
+Circuit::Circuit(std::vector<Op> &&_ops, const json_t &circ,
+                 const json_t &qobj_config) : Circuit() {
+  if (JSON::check_key("instructions", circ) == false) {
+    throw std::invalid_argument("Invalid Qobj experiment: no \"instructions\" field.");
+  }
+  ops = std::move(_ops);
+  load_experiment(circ, qobj_config);
+}
+
+void Circuit::load_experiment(const json_t &circ, const json_t &qobj_config) {
+  // Get config
+  // Circuit level config values overwrite qobj level values. Values are
+  // looked up in both configs rather than merging them, as the qobj config
+  // is shared by all experiments and may be large.
+  static const json_t no_config = json_t::object();
+  const json_t &circ_config = JSON::check_key("config", circ) ? circ["config"] : no_config;
+  if (!circ_config.is_object()) {
+    throw std::invalid_argument("Invalid Qobj experiment: \"config\" is not an object.");
+  }
+  auto config = [&](const std::string &key) -> const json_t & {
+    return (circ_config.find(key) != circ_config.end()) ? circ_config : qobj_config;
+  };
 
   // Set optype information
   opset_ = Operations::OpSet(ops);
@@ -150,11 +175,11 @@ Circuit::Circuit(const json_t &circ, const json_t &qobj_config) : Circuit() {
 
   // Load metadata
   JSON::get_value(header, "header", circ);
-  JSON::get_value(shots, "shots", config);
+  JSON::get_value(shots, "shots", config("shots"));
 
   // Check for specified memory slots
   uint_t memory_slots = 0;
-  JSON::get_value(memory_slots, "memory_slots", config);
+  JSON::get_value(memory_slots, "memory_slots", config("memory_slots"));
   if (memory_slots < num_memory) {
     throw std::invalid_argument("Invalid Qobj experiment: not enough memory slots.");
   }
@@ -162,8 +187,8 @@ Circuit::Circuit(const json_t &circ, const json_t &qobj_config) : Circuit() {
   num_memory = memory_slots;
 
   // Check for specified n_qubits
-  if (JSON::check_key("n_qubits", config)) {
-    uint_t n_qubits = config["n_qubits"];
+  if (JSON::check_key("n_qubits", config("n_qubits"))) {
+    uint_t n_qubits = config("n_qubits")["n_qubits"];
     if (n_qubits < num_qubits) {
       throw std::invalid_argument("Invalid Qobj experiment: n_qubits < instruction qubits.");
     }
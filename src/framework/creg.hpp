@@ -15,6 +15,7 @@
 #ifndef _aer_framework_creg_hpp_
 #define _aer_framework_creg_hpp_
 
+#include "framework/json.hpp"
 #include "framework/operations.hpp"
 #include "framework/utils.hpp"
 #include "framework/rng.hpp"
@@ -26,35 +27,41 @@ namespace AER {
 //============================================================================
 
 // ClassicalRegister class
+//
+// The memory and register bits are packed into 64-bit words with the least
+// significant word first, and bits beyond the size of the memory or register
+// are always 0.
 class ClassicalRegister {
 
 public:
 
   // Return the current value of the memory as little-endian hex-string
-  inline std::string memory_hex() const {return Utils::bin2hex(creg_memory_);}
+  inline std::string memory_hex() const {return Utils::words2hex(creg_memory_);}
 
   // Return the current value of the memory as little-endian bit-string
-  inline std::string memory_bin() const {return "0b" + creg_memory_;}
+  inline std::string memory_bin() const {return "0b" + words2bin(creg_memory_, memory_size_);}
+
+  // Return the current value of the memory as 64-bit words with the least
+  // significant word first
+  inline const reg_t &memory_words() const {return creg_memory_;}
 
   // Return the current value of the memory as little-endian hex-string
-  inline std::string register_hex() const {return Utils::bin2hex(creg_register_);}
+  inline std::string register_hex() const {return Utils::words2hex(creg_register_);}
 
   // Return the current value of the memory as little-endian bit-string
-  inline std::string register_bin() const {return "0b" + creg_register_;}
+  inline std::string register_bin() const {return "0b" + words2bin(creg_register_, register_size_);}
 
   // Return the size of the memory bits
-  size_t memory_size() const {return creg_memory_.size();}
+  size_t memory_size() const {return memory_size_;}
 
   // Return the size of the register bits
-  size_t register_size() const {return creg_register_.size();}
+  size_t register_size() const {return register_size_;}
 
-  // Return a reference to the current value of the memory
-  // this is a bit-string without the "0b" prefix.
-  inline auto& creg_memory() {return creg_memory_;}
+  // Return the memory and register bits as JSON for checkpointing
+  json_t checkpoint() const;
 
-  // Return a reference to the current value of the memory
-  // this is a bit-string without the "0b" prefix.
-  inline auto& creg_register() {return creg_register_;}
+  // Restore the memory and register bits from a checkpoint JSON
+  void load_checkpoint(const json_t &js);
 
   // Initialize the memory and register bits to default values (all 0)
   void initialize(size_t num_memory, size_t num_registers);
@@ -81,9 +88,34 @@ public:
 
 protected:
 
+  // Return the number of 64-bit words for a number of bits
+  static size_t num_words(size_t num_bits) {return (num_bits + 63) / 64;}
+
+  // Get and set a single bit of packed words
+  static bool get_bit(const reg_t &words, uint_t bit) {
+    return (words[bit / 64] >> (bit % 64)) & 1ULL;
+  }
+  static void set_bit(reg_t &words, uint_t bit, bool value) {
+    const uint_t mask = 1ULL << (bit % 64);
+    if (value)
+      words[bit / 64] |= mask;
+    else
+      words[bit / 64] &= ~mask;
+  }
+
+  // Convert between packed words and bit-strings of a number of bits
+  static std::string words2bin(const reg_t &words, size_t num_bits);
+  static reg_t bin2words(const std::string &bin, size_t num_bits);
+
+  // Convert a hex-string to packed words of a number of bits, discarding
+  // any bits beyond the number of bits
+  static reg_t hex2words(const std::string &hex, size_t num_bits);
+
   // Classical registers
-  std::string creg_memory_;   // standard classical bit memory
-  std::string creg_register_; // optional classical bit register
+  reg_t creg_memory_;   // standard classical bit memory
+  reg_t creg_register_; // optional classical bit register
+  size_t memory_size_ = 0;
+  size_t register_size_ = 0;
 
   // Measurement config settings
   bool return_hex_strings_ = true;       // Set to false for bit-string output
@@ -93,10 +125,42 @@ protected:
 // Implementations
 //============================================================================
 
+std::string ClassicalRegister::words2bin(const reg_t &words, size_t num_bits) {
+  std::string bin(num_bits, '0');
+  for (size_t j = 0; j < num_bits; ++j) {
+    if (get_bit(words, j))
+      bin[num_bits - 1 - j] = '1';
+  }
+  return bin;
+}
+
+
+reg_t ClassicalRegister::bin2words(const std::string &bin, size_t num_bits) {
+  reg_t words(num_words(num_bits), 0);
+  const size_t size = std::min(bin.size(), num_bits);
+  for (size_t j = 0; j < size; ++j) {
+    if (bin[bin.size() - 1 - j] == '1')
+      set_bit(words, j, true);
+  }
+  return words;
+}
+
+
+reg_t ClassicalRegister::hex2words(const std::string &hex, size_t num_bits) {
+  reg_t words = Utils::hex2words(hex);
+  words.resize(num_words(num_bits), 0);
+  if (num_bits % 64)
+    words.back() &= (1ULL << (num_bits % 64)) - 1;
+  return words;
+}
+
+
 void ClassicalRegister::initialize(size_t num_memory, size_t num_register) {
   // Set registers to the all 0 bit state
-  creg_memory_ = std::string(num_memory, '0');
-  creg_register_ = std::string(num_register, '0');
+  memory_size_ = num_memory;
+  register_size_ = num_register;
+  creg_memory_.assign(num_words(num_memory), 0);
+  creg_register_.assign(num_words(num_register), 0);
 }
 
 
@@ -104,12 +168,28 @@ void ClassicalRegister::initialize(size_t num_memory,
                                    size_t num_register,
                                    const std::string &memory_hex,
                                    const std::string &register_hex) {
-  // Convert to bit-string for internal storage
-  std::string memory_bin = Utils::hex2bin(memory_hex, false);
-  creg_memory_ = std::move(Utils::padleft_inplace(memory_bin, '0', num_memory));
+  memory_size_ = num_memory;
+  register_size_ = num_register;
+  creg_memory_ = hex2words(memory_hex, num_memory);
+  creg_register_ = hex2words(register_hex, num_register);
+}
+
 
-  std::string register_bin = Utils::hex2bin(register_hex, false);
-  creg_register_ = std::move(Utils::padleft_inplace(memory_bin, '0', num_register));
+json_t ClassicalRegister::checkpoint() const {
+  json_t js;
+  js["memory"] = words2bin(creg_memory_, memory_size_);
+  js["register"] = words2bin(creg_register_, register_size_);
+  return js;
+}
+
+
+void ClassicalRegister::load_checkpoint(const json_t &js) {
+  const std::string memory = js["memory"].get<std::string>();
+  const std::string reg = js["register"].get<std::string>();
+  memory_size_ = memory.size();
+  register_size_ = reg.size();
+  creg_memory_ = bin2words(memory, memory_size_);
+  creg_register_ = bin2words(reg, register_size_);
 }
 
 
@@ -120,16 +200,10 @@ void ClassicalRegister::store_measure(const reg_t &outcome,
   bool use_mem = !memory.empty();
   bool use_reg = !registers.empty();
   for (size_t j=0; j < outcome.size(); j++) {
-    if (use_mem) {
-      // least significant bit first ordering
-      const size_t pos = creg_memory_.size() - memory[j] - 1; 
-      creg_memory_[pos] = std::to_string(outcome[j])[0]; // int->string->char
-    }
-    if (use_reg) {
-      // least significant bit first ordering
-      const size_t pos = creg_register_.size() - registers[j] - 1; 
-      creg_register_[pos] = std::to_string(outcome[j])[0];  // int->string->char
-    }
+    if (use_mem)
+      set_bit(creg_memory_, memory[j], outcome[j]);
+    if (use_reg)
+      set_bit(creg_register_, registers[j], outcome[j]);
   }
 }
 
@@ -137,20 +211,32 @@ void ClassicalRegister::store_measure(const reg_t &outcome,
 bool ClassicalRegister::check_conditional(const Operations::Op &op) const {
   // Check if op is conditional
   if (op.conditional)
-    return (creg_register_[creg_register_.size() - op.conditional_reg - 1] == '1');
+    return get_bit(creg_register_, op.conditional_reg);
   
   // DEPRECATED: old style conditional
   if (op.old_conditional) {
-    std::string current;
-    auto mask = Utils::padleft(Utils::hex2bin(op.old_conditional_mask, false),
-                               '0', creg_memory_.size());
-    for (size_t pos=0; pos < mask.size(); pos++) {
-      if (mask[pos] == '1')
-        current.push_back(creg_memory_[pos]);
+    // Gather the memory bits selected by the mask into the low bits of the
+    // current value and compare it to the conditional value
+    reg_t current(creg_memory_.size(), 0);
+    uint_t pos = 0;
+    const size_t words = std::min(op.mask_words.size(), creg_memory_.size());
+    for (size_t w = 0; w < words; ++w) {
+      uint_t mask = op.mask_words[w];
+      while (mask) {
+        const uint_t bit = mask & (~mask + 1);
+        if (creg_memory_[w] & bit)
+          current[pos / 64] |= 1ULL << (pos % 64);
+        pos++;
+        mask ^= bit;
+      }
+    }
+    for (size_t w = 0; w < std::max(current.size(), op.val_words.size()); ++w) {
+      const uint_t cur = (w < current.size()) ? current[w] : 0;
+      const uint_t val = (w < op.val_words.size()) ? op.val_words[w] : 0;
+      if (cur != val)
+        return false;
     }
-    auto val = Utils::padleft(Utils::hex2bin(op.old_conditional_val, false),
-                              '0', current.size());
-    return (val == current);
+    return true;
   }
 
   // Op is not conditional
@@ -165,29 +251,19 @@ void ClassicalRegister::apply_bfunc(const Operations::Op &op) {
     throw std::invalid_argument("ClassicalRegister::apply_bfunc: Input is not a bfunc op.");
   }
 
-  const std::string &mask = op.string_params[0];
-  const std::string &target_val = op.string_params[1];
-  int_t compared; // if equal this should be 0, if less than -1, if greater than +1
-
-  // Check if register size fits into a 64-bit integer
-  if (creg_register_.size() <= 64) {
-    uint_t reg_int = std::stoull(creg_register_, nullptr, 2); // stored as bitstring
-    uint_t mask_int = std::stoull(mask, nullptr, 16); // stored as hexstring
-    uint_t target_int = std::stoull(target_val, nullptr, 16); // stored as hexstring
-    compared = (reg_int & mask_int) - target_int;
-  } else {
-    // We need to use big ints so we implement the bit-mask via the binary string
-    // representation rather than using a big integer class
-    std::string mask_bin = Utils::hex2bin(mask); // has 0b prefix while creg_register_ doesn't
-    size_t length = std::min(mask_bin.size() - 2, creg_register_.size()); // -2 to remove 0b
-    std::string masked_val = std::string(length, '0');
-    for (size_t rev_pos = 0; rev_pos < length; rev_pos++) {
-      masked_val[length - 1 - rev_pos] = (mask_bin[mask_bin.size() - 1 - rev_pos] 
-                                          & creg_register_[creg_register_.size() - 1 - rev_pos]);
+  // Compare the masked register to the target value starting from the most
+  // significant word. If equal this is 0, if less than -1, if greater than +1
+  int_t compared = 0;
+  const size_t words = std::max(op.mask_words.size(), op.val_words.size());
+  for (size_t w = words; w-- > 0;) {
+    const uint_t reg = (w < creg_register_.size()) ? creg_register_[w] : 0;
+    const uint_t mask = (w < op.mask_words.size()) ? op.mask_words[w] : 0;
+    const uint_t target = (w < op.val_words.size()) ? op.val_words[w] : 0;
+    const uint_t masked = reg & mask;
+    if (masked != target) {
+      compared = (masked < target) ? -1 : 1;
+      break;
     }
-    masked_val = Utils::bin2hex(masked_val); // convert to hex string
-    // Using string comparison to compare to target value
-    compared = masked_val.compare(target_val);
   }
   // check value of compared integer for different comparison operations
   bool outcome;
@@ -215,15 +291,11 @@ void ClassicalRegister::apply_bfunc(const Operations::Op &op) {
       throw std::invalid_argument("Invalid boolean function relation.");
   }
   // Store outcome in register
-  if (op.registers.size() > 0) {
-    const size_t pos = creg_register_.size() - op.registers[0] - 1; 
-    creg_register_[pos] = (outcome) ? '1' : '0';
-  }
+  if (op.registers.size() > 0)
+    set_bit(creg_register_, op.registers[0], outcome);
   // Optionally store outcome in memory
-  if (op.memory.size() > 0) {
-    const size_t pos = creg_memory_.size() - op.memory[0] - 1; 
-    creg_memory_[pos] = (outcome) ? '1' : '0';
-  }
+  if (op.memory.size() > 0)
+    set_bit(creg_memory_, op.memory[0], outcome);
 }
 
 // Apply readout error instruction to classical registers
@@ -234,27 +306,22 @@ void ClassicalRegister::apply_roerror(const Operations::Op &op, RngEngine &rng)
     throw std::invalid_argument("ClassicalRegister::apply_roerror Input is not a readout error op.");
   }
   
-  // Get current classical bit (and optionally register bit) values
-  std::string mem_str;
-  
-  // Get values of bits as binary string
-  // We iterate from the end of the list of memory bits
-  for (auto it = op.memory.rbegin(); it < op.memory.rend(); ++it) {
-    auto bit = *it;
-    mem_str.push_back(creg_memory_[creg_memory_.size() - 1 - bit]);
-  }
-  auto mem_val = std::stoull(mem_str, nullptr, 2);
-  auto outcome = rng.rand_int(op.probs[mem_val]);
-  auto noise_str = Utils::int2string(outcome, 2, op.memory.size());
+  // Get current value of the classical bits, with the first memory bit of
+  // the op as the least significant bit
+  uint_t mem_val = 0;
   for (size_t pos = 0; pos < op.memory.size(); ++pos) {
-    auto bit = op.memory[pos];
-    creg_memory_[creg_memory_.size() - 1 - bit] = noise_str[noise_str.size() - 1 - pos];
+    if (get_bit(creg_memory_, op.memory[pos]))
+      mem_val |= 1ULL << pos;
   }
+  // Use the precomputed alias tables of the op if they are available
+  const uint_t outcome = (op.probs_tables && op.probs_tables->size() == op.probs.size())
+    ? rng.rand_int((*op.probs_tables)[mem_val])
+    : rng.rand_int(op.probs[mem_val]);
+  for (size_t pos = 0; pos < op.memory.size(); ++pos)
+    set_bit(creg_memory_, op.memory[pos], (outcome >> pos) & 1ULL);
   // and the same error to register classical bits if they are used
-  for (size_t pos = 0; pos < op.registers.size(); ++pos) {
-    auto bit = op.registers[pos];
-    creg_register_[creg_register_.size() - 1 - bit] = noise_str[noise_str.size() - 1 - pos];
-  }
+  for (size_t pos = 0; pos < op.registers.size(); ++pos)
+    set_bit(creg_register_, op.registers[pos], (outcome >> pos) & 1ULL);
 }
 
 //------------------------------------------------------------------------------
@@ -20,6 +20,8 @@
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include <iostream>
@@ -71,6 +73,25 @@ bool check_keys(std::vector<std::string> keys, const json_t &js);
  */
 template <typename T> bool get_value(T &var, std::string key, const json_t &js);
 
+/**
+ * Serialize a json_t to a string in a text or binary format.
+ * @param js: the json_t to serialize.
+ * @param format: "json" for JSON text, or "msgpack" or "cbor" for the
+ *                MessagePack or CBOR binary encodings.
+ * @param indent: indentation of JSON text, or -1 for compact text.
+ * @returns: the serialized string.
+ */
+std::string serialize(const json_t &js, const std::string &format,
+                      int indent = -1);
+
+/**
+ * Check that a serialization format is supported by serialize.
+ * @param format: the format name.
+ * @throws std::invalid_argument if the format is not "json", "msgpack" or
+ *         "cbor".
+ */
+void check_format(const std::string &format);
+
 } // end namespace JSON
 
 //============================================================================
@@ -179,6 +200,24 @@ bool JSON::check_key(std::string key, const json_t &js) {
     return false;
 }
 
+std::string JSON::serialize(const json_t &js, const std::string &format,
+                            int indent) {
+  check_format(format);
+  if (format == "json")
+    return js.dump(indent);
+  std::string ret;
+  if (format == "msgpack")
+    json_t::to_msgpack(js, ret);
+  else
+    json_t::to_cbor(js, ret);
+  return ret;
+}
+
+void JSON::check_format(const std::string &format) {
+  if (format != "json" && format != "msgpack" && format != "cbor")
+    throw std::invalid_argument("Invalid serialization format \"" + format + "\".");
+}
+
 bool JSON::check_keys(std::vector<std::string> keys, const json_t &js) {
   bool pass = true;
   for (auto s : keys)
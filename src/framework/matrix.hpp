@@ -35,6 +35,7 @@ Multiplication is done with the C wrapper of the fortran blas library.
 #include <iostream>
 #include <vector>
 #include <array>
+#include <utility>
 
 /*******************************************************************************
  *
@@ -207,6 +208,7 @@ public:
   explicit matrix(size_t size); // Makes a square matrix and rows = sqrt(size) columns =
                                 // sqrt(dims)
   matrix(const matrix<T> &m);
+  matrix(matrix<T> &&m) noexcept;
   matrix(const matrix<T> &m, const char uplo);
 
   // Initialize an empty matrix() to matrix(size_t  rows, size_t cols)
@@ -219,6 +221,7 @@ public:
 
   // Assignment operator
   matrix<T> &operator=(const matrix<T> &m);
+  matrix<T> &operator=(matrix<T> &&m) noexcept;
   template <class S>
   matrix<T> &operator=(const matrix<S> &m); // Still would like to have real
                                             // assigend by complex -- take real
@@ -319,6 +322,15 @@ inline matrix<T>::matrix(const matrix<T> &rhs)
   }
 }
 template <class T>
+inline matrix<T>::matrix(matrix<T> &&rhs) noexcept
+    : rows_(rhs.rows_), cols_(rhs.cols_), size_(rhs.size_), LD_(rhs.LD_),
+      outputstyle_(rhs.outputstyle_), mat_(rhs.mat_) {
+  // Move constructor, takes the memory of the other matrix and leaves it
+  // as an empty matrix
+  rhs.rows_ = rhs.cols_ = rhs.size_ = rhs.LD_ = 0;
+  rhs.mat_ = nullptr;
+}
+template <class T>
 inline matrix<T>::matrix(const matrix<T> &rhs, const char uplo)
     : rows_(rhs.rows_), cols_(rhs.cols_), size_(rhs.size_), LD_(rows_),
       outputstyle_(rhs.outputstyle_), mat_(new T[size_]) {
@@ -384,6 +396,18 @@ template <class T> inline matrix<T>::~matrix() {
     delete[](mat_);
 }
 template <class T>
+inline matrix<T> &matrix<T>::operator=(matrix<T> &&rhs) noexcept {
+  // Move assignment, swaps the memory with the other matrix which deletes
+  // the previous memory of this matrix when it leaves scope
+  std::swap(rows_, rhs.rows_);
+  std::swap(cols_, rhs.cols_);
+  std::swap(size_, rhs.size_);
+  std::swap(LD_, rhs.LD_);
+  std::swap(outputstyle_, rhs.outputstyle_);
+  std::swap(mat_, rhs.mat_);
+  return *this;
+}
+template <class T>
 inline matrix<T> &matrix<T>::operator=(const matrix<T> &rhs) {
   // overloading the assignement operator
   // postcondition: normal assignment via copying has been performed;
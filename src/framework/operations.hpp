@@ -16,13 +16,18 @@
 #define _aer_framework_operations_hpp_
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <mutex>
 #include <stdexcept>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <tuple>
 
 #include "framework/types.hpp"
 #include "framework/json.hpp"
+#include "framework/rng.hpp"
 #include "framework/utils.hpp"
 
 namespace AER {
@@ -36,7 +41,8 @@ enum class RegComparison {Equal, NotEqual, Less, LessEqual, Greater, GreaterEqua
 // Enum class for operation types
 enum class OpType {
   gate, measure, reset, bfunc, barrier, snapshot,
-  matrix, multiplexer, kraus, superop, roerror, noise_switch, initialize
+  matrix, multiplexer, kraus, superop, roerror, noise_switch, initialize,
+  thermal_relaxation
 };
 
 inline std::ostream& operator<<(std::ostream& stream, const OpType& type) {
@@ -80,6 +86,9 @@ inline std::ostream& operator<<(std::ostream& stream, const OpType& type) {
   case OpType::initialize:
     stream << "initialize";
     break;
+  case OpType::thermal_relaxation:
+    stream << "thermal_relaxation";
+    break;
   default:
     stream << "unknown";
   }
@@ -87,6 +96,22 @@ inline std::ostream& operator<<(std::ostream& stream, const OpType& type) {
 }
 
 
+// Enum class for the names of standard gates. The identifier of a gate op
+// is resolved from its name once when the op is constructed, so that
+// simulators can look up gates by index rather than hashing the gate name
+// each time a gate is applied. Other gate names are `unknown`.
+enum class GateID : uint8_t {
+  unknown,
+  id, x, y, z, h, s, sdg, t, tdg, u0, u1, u2, u3,
+  cx, cy, cz, swap, cu1, cu2, cu3,
+  ccx, ccz, cswap,
+  mcx, mcy, mcz, mcu1, mcu2, mcu3, mcswap,
+  num_ids // number of gate identifiers
+};
+
+// Return the identifier of a gate name
+GateID gate_id(const std::string &name);
+
 //------------------------------------------------------------------------------
 // Op Class
 //------------------------------------------------------------------------------
@@ -95,6 +120,7 @@ struct Op {
   // General Operations
   OpType type;                    // operation type identifier
   std::string name;               // operation name
+  GateID gate = GateID::unknown;  // identifier of the gate name
   reg_t qubits;                   //  qubits operation acts on
   std::vector<reg_t> regs;        //  list of qubits for matrixes
   std::vector<complex_t> params;  // real or complex params for gates
@@ -110,6 +136,11 @@ struct Op {
   std::string old_conditional_mask; // hex string for conditional mask
   std::string old_conditional_val;  // hex string for conditional value
 
+  // Mask and value hex strings of bfunc and old style conditional ops
+  // precompiled to 64-bit words with the least significant word first
+  reg_t mask_words;
+  reg_t val_words;
+
   // Measurement
   reg_t memory;             // (opt) register operation it acts on (measure)
   reg_t registers;          // (opt) register locations it acts on (measure, conditional)
@@ -119,6 +150,8 @@ struct Op {
 
   // Readout error
   std::vector<rvector_t> probs;
+  // Alias tables for sampling probs, which are shared by copies of the op
+  std::shared_ptr<const std::vector<AliasTable>> probs_tables;
 
   // Snapshots
   using pauli_component_t = std::pair<complex_t, std::string>; // Pair (coeff, label_string)
@@ -130,6 +163,51 @@ struct Op {
                                                         // M x 1 column-matrices
 };
 
+//------------------------------------------------------------------------------
+// Gate table
+//------------------------------------------------------------------------------
+
+// Table of the gates supported by a simulator, indexed by gate identifier.
+// The table is built from the gate set of the simulator, which maps gate
+// names to its gate enum, the first time a gate is looked up so that it can
+// be a static member defined alongside the gate set.
+template <class gate_t>
+class GateTable {
+public:
+  explicit GateTable(const stringmap_t<gate_t> &gateset) : gateset_(gateset) {}
+
+  // Return a pointer to the simulator gate of an op, or nullptr if the gate
+  // isn't supported. Gates without an identifier are looked up by name.
+  const gate_t *find(const Op &op) const;
+
+private:
+  static constexpr size_t num_ids_ = static_cast<size_t>(GateID::num_ids);
+
+  const stringmap_t<gate_t> &gateset_;
+  mutable std::array<gate_t, num_ids_> gates_;
+  mutable std::array<bool, num_ids_> supported_;
+  mutable std::once_flag built_;
+};
+
+template <class gate_t>
+const gate_t *GateTable<gate_t>::find(const Op &op) const {
+  if (op.gate == GateID::unknown) {
+    auto it = gateset_.find(op.name);
+    return (it == gateset_.end()) ? nullptr : &(it->second);
+  }
+  std::call_once(built_, [this]() {
+    supported_.fill(false);
+    for (const auto &pair : gateset_) {
+      const auto id = static_cast<size_t>(gate_id(pair.first));
+      gates_[id] = pair.second;
+      supported_[id] = true;
+    }
+    supported_[static_cast<size_t>(GateID::unknown)] = false;
+  });
+  const auto id = static_cast<size_t>(op.gate);
+  return supported_[id] ? &gates_[id] : nullptr;
+}
+
 inline std::ostream& operator<<(std::ostream& s, const Op& op) {
   s << op.name << "[";
   bool first = true;
@@ -431,6 +509,7 @@ inline Op make_u1(uint_t qubit, T lam) {
   Op op;
   op.type = OpType::gate;
   op.name = "u1";
+  op.gate = GateID::u1;
   op.qubits = {qubit};
   op.params = {lam};
   op.string_params = {op.name};
@@ -442,6 +521,7 @@ inline Op make_u2(uint_t qubit, T phi, T lam) {
   Op op;
   op.type = OpType::gate;
   op.name = "u2";
+  op.gate = GateID::u2;
   op.qubits = {qubit};
   op.params = {phi, lam};
   op.string_params = {op.name};
@@ -453,6 +533,7 @@ inline Op make_u3(uint_t qubit, T theta, T phi, T lam) {
   Op op;
   op.type = OpType::gate;
   op.name = "u3";
+  op.gate = GateID::u3;
   op.qubits = {qubit};
   op.params = {theta, phi, lam};
   op.string_params = {op.name};
@@ -526,15 +607,86 @@ inline Op make_kraus(const reg_t &qubits, const std::vector<cmatrix_t> &mats) {
   return op;
 }
 
-inline Op make_roerror(const reg_t &memory, const std::vector<rvector_t> &probs) {
+// Raise an exception if a thermal relaxation op is not a valid channel
+inline void check_thermal_relaxation(const Op &op) {
+  if (op.qubits.size() != 1)
+    throw std::invalid_argument(R"(Invalid qobj "thermal_relaxation" instruction)"
+                                R"( (must act on a single qubit).)");
+  if (op.params.size() != 3 && op.params.size() != 4)
+    throw std::invalid_argument(R"(Invalid qobj "thermal_relaxation" instruction)"
+                                R"( ("params" is incorrect length).)");
+  const double t1 = std::real(op.params[0]);
+  const double t2 = std::real(op.params[1]);
+  const double time = std::real(op.params[2]);
+  const double excited = (op.params.size() == 4) ? std::real(op.params[3]) : 0.;
+  if (t1 <= 0 || t2 <= 0 || t2 > 2 * t1)
+    throw std::invalid_argument(R"(Invalid qobj "thermal_relaxation" instruction)"
+                                R"( (require 0 < T2 <= 2 * T1).)");
+  if (time < 0 || excited < 0 || excited > 1)
+    throw std::invalid_argument(R"(Invalid qobj "thermal_relaxation" instruction)"
+                                R"( (require time >= 0 and excited state population in [0, 1]).)");
+}
+
+// Single-qubit thermal relaxation channel with relaxation time T1,
+// dephasing time T2 <= 2 * T1 and excited state population at equilibrium
+inline Op make_thermal_relaxation(uint_t qubit, double t1, double t2,
+                                  double time, double excited_population = 0.) {
+  Op op;
+  op.type = OpType::thermal_relaxation;
+  op.name = "thermal_relaxation";
+  op.qubits = {qubit};
+  op.params = {t1, t2, time, excited_population};
+  check_thermal_relaxation(op);
+  return op;
+}
+
+// Closed form of the thermal relaxation channel of an op. The channel
+// maps the populations p0, p1 of the qubit to
+//   (1 - p_reset) * (p0, p1) + p_reset * (1 - p_excited, p_excited) * (p0 + p1)
+// and multiplies its coherences by the coherence factor.
+struct ThermalRelaxation {
+  double p_reset;
+  double p_excited;
+  double coherence;
+};
+
+inline ThermalRelaxation thermal_relaxation_channel(const Op &op) {
+  const double t1 = std::real(op.params[0]);
+  const double t2 = std::real(op.params[1]);
+  const double time = std::real(op.params[2]);
+  ThermalRelaxation channel;
+  channel.p_reset = 1. - std::exp(-time / t1);
+  channel.p_excited = (op.params.size() == 4) ? std::real(op.params[3]) : 0.;
+  channel.coherence = std::exp(-time / t2);
+  return channel;
+}
+
+// Return the alias tables for sampling each row of readout error probabilities
+inline std::shared_ptr<const std::vector<AliasTable>>
+make_alias_tables(const std::vector<rvector_t> &probs) {
+  auto tables = std::make_shared<std::vector<AliasTable>>();
+  tables->reserve(probs.size());
+  for (const auto &row : probs)
+    tables->emplace_back(row);
+  return tables;
+}
+
+// Return a readout error op sampled with the input alias tables of probs
+inline Op make_roerror(const reg_t &memory, const std::vector<rvector_t> &probs,
+                       std::shared_ptr<const std::vector<AliasTable>> tables) {
   Op op;
   op.type = OpType::roerror;
   op.name = "roerror";
   op.memory = memory;
   op.probs = probs;
+  op.probs_tables = std::move(tables);
   return op;
 }
 
+inline Op make_roerror(const reg_t &memory, const std::vector<rvector_t> &probs) {
+  return make_roerror(memory, probs, make_alias_tables(probs));
+}
+
 //------------------------------------------------------------------------------
 // JSON conversion
 //------------------------------------------------------------------------------
@@ -565,10 +717,24 @@ Op json_to_op_superop(const json_t &js);
 Op json_to_op_multiplexer(const json_t &js);
 Op json_to_op_kraus(const json_t &js);
 Op json_to_op_noise_switch(const json_t &js);
+Op json_to_op_thermal_relaxation(const json_t &js);
 
 // Classical bits
 Op json_to_op_roerror(const json_t &js);
 
+// Operations whose "params" have already been converted, so that the
+// params of an instruction don't need to be stored as JSON. The "params"
+// field of the JSON instruction is ignored.
+Op json_to_op(const json_t &js, std::vector<cmatrix_t> &&mats);
+Op json_to_op_initialize(const json_t &js, std::vector<complex_t> &&params);
+Op json_to_op_unitary(const json_t &js, std::vector<cmatrix_t> &&mats);
+Op json_to_op_superop(const json_t &js, std::vector<cmatrix_t> &&mats);
+Op json_to_op_multiplexer(const json_t &js, std::vector<cmatrix_t> &&mats);
+Op json_to_op_kraus(const json_t &js, std::vector<cmatrix_t> &&mats);
+
+// Return true if the "params" of an instruction are a list of matrices
+bool has_matrix_params(const std::string &name);
+
 // Optional instruction parameters
 enum class Allowed {Yes, No};
 void add_condtional(const Allowed val, Op& op, const json_t &js);
@@ -613,10 +779,32 @@ Op json_to_op(const json_t &js) {
     return json_to_op_kraus(js);
   if (name == "roerror")
     return json_to_op_roerror(js);
+  if (name == "thermal_relaxation")
+    return json_to_op_thermal_relaxation(js);
   // Default assume gate
   return json_to_op_gate(js);
 }
 
+Op json_to_op(const json_t &js, std::vector<cmatrix_t> &&mats) {
+  std::string name;
+  JSON::get_value(name, "name", js);
+  if (name == "unitary")
+    return json_to_op_unitary(js, std::move(mats));
+  if (name == "superop")
+    return json_to_op_superop(js, std::move(mats));
+  if (name == "multiplexer")
+    return json_to_op_multiplexer(js, std::move(mats));
+  if (name == "kraus")
+    return json_to_op_kraus(js, std::move(mats));
+  throw std::invalid_argument("Invalid instruction: \"" + name +
+                              "\" params are not matrices.");
+}
+
+bool has_matrix_params(const std::string &name) {
+  return name == "unitary" || name == "superop" || name == "multiplexer" ||
+         name == "kraus";
+}
+
 json_t op_to_json(const Op &op) {
   json_t ret;
   ret["name"] = op.name;
@@ -659,16 +847,36 @@ void add_condtional(const Allowed allowed, Op& op, const json_t &js) {
       // DEPRECATED: old style conditional (remove in 0.3)
       JSON::get_value(op.old_conditional_mask, "mask", js["conditional"]);
       JSON::get_value(op.old_conditional_val, "val", js["conditional"]);
+      op.mask_words = Utils::hex2words(op.old_conditional_mask);
+      op.val_words = Utils::hex2words(op.old_conditional_val);
       op.old_conditional = true;
     }
   }
 }
 
 
+GateID gate_id(const std::string &name) {
+  static const stringmap_t<GateID> ids({
+    {"id", GateID::id}, {"x", GateID::x}, {"y", GateID::y}, {"z", GateID::z},
+    {"h", GateID::h}, {"s", GateID::s}, {"sdg", GateID::sdg},
+    {"t", GateID::t}, {"tdg", GateID::tdg}, {"u0", GateID::u0},
+    {"u1", GateID::u1}, {"u2", GateID::u2}, {"u3", GateID::u3},
+    {"cx", GateID::cx}, {"cy", GateID::cy}, {"cz", GateID::cz},
+    {"swap", GateID::swap}, {"cu1", GateID::cu1}, {"cu2", GateID::cu2},
+    {"cu3", GateID::cu3}, {"ccx", GateID::ccx}, {"ccz", GateID::ccz},
+    {"cswap", GateID::cswap}, {"mcx", GateID::mcx}, {"mcy", GateID::mcy},
+    {"mcz", GateID::mcz}, {"mcu1", GateID::mcu1}, {"mcu2", GateID::mcu2},
+    {"mcu3", GateID::mcu3}, {"mcswap", GateID::mcswap}
+  });
+  auto it = ids.find(name);
+  return (it == ids.end()) ? GateID::unknown : it->second;
+}
+
 Op json_to_op_gate(const json_t &js) {
   Op op;
   op.type = OpType::gate;
   JSON::get_value(op.name, "name", js);
+  op.gate = gate_id(op.name);
   JSON::get_value(op.qubits, "qubits", js);
   JSON::get_value(op.params, "params", js);
 
@@ -750,11 +958,17 @@ Op json_to_op_reset(const json_t &js) {
 
 
 Op json_to_op_initialize(const json_t &js) {
+  std::vector<complex_t> params;
+  JSON::get_value(params, "params", js);
+  return json_to_op_initialize(js, std::move(params));
+}
+
+Op json_to_op_initialize(const json_t &js, std::vector<complex_t> &&params) {
   Op op;
   op.type = OpType::initialize;
   op.name = "initialize";
   JSON::get_value(op.qubits, "qubits", js);
-  JSON::get_value(op.params, "params", js);
+  op.params = std::move(params);
 
   // Conditional
   add_condtional(Allowed::No, op, js);
@@ -792,6 +1006,8 @@ Op json_to_op_bfunc(const json_t &js) {
   // Format hex strings
   Utils::format_hex_inplace(op.string_params[0]);
   Utils::format_hex_inplace(op.string_params[1]);
+  op.mask_words = Utils::hex2words(op.string_params[0]);
+  op.val_words = Utils::hex2words(op.string_params[1]);
 
   const stringmap_t<RegComparison> comp_table({
     {"==", RegComparison::Equal},
@@ -805,7 +1021,7 @@ Op json_to_op_bfunc(const json_t &js) {
   auto it = comp_table.find(relation);
   if (it == comp_table.end()) {
     std::stringstream msg;
-    msg << "Invalid bfunc relation string :\"" << it->first << "\"." << std::endl;
+    msg << "Invalid bfunc relation string :\"" << relation << "\"." << std::endl;
     throw std::invalid_argument(msg.str());
   } else {
     op.bfunc = it->second;
@@ -830,6 +1046,7 @@ Op json_to_op_roerror(const json_t &js) {
   JSON::get_value(op.registers, "register", js);
   JSON::get_value(op.probs, "probabilities", js); // DEPRECATED: Remove in 0.4
   JSON::get_value(op.probs, "params", js);
+  op.probs_tables = make_alias_tables(op.probs);
   // Conditional
   add_condtional(Allowed::No, op, js);
   return op;
@@ -840,11 +1057,17 @@ Op json_to_op_roerror(const json_t &js) {
 //------------------------------------------------------------------------------
 
 Op json_to_op_unitary(const json_t &js) {
+  std::vector<cmatrix_t> mats;
+  JSON::get_value(mats, "params", js);
+  return json_to_op_unitary(js, std::move(mats));
+}
+
+Op json_to_op_unitary(const json_t &js, std::vector<cmatrix_t> &&mats) {
   Op op;
   op.type = OpType::matrix;
   op.name = "unitary";
   JSON::get_value(op.qubits, "qubits", js);
-  JSON::get_value(op.mats, "params", js);
+  op.mats = std::move(mats);
   // Validation
   check_empty_qubits(op);
   check_duplicate_qubits(op);
@@ -867,12 +1090,18 @@ Op json_to_op_unitary(const json_t &js) {
 }
 
 Op json_to_op_superop(const json_t &js) {
+  std::vector<cmatrix_t> mats;
+  JSON::get_value(mats, "params", js);
+  return json_to_op_superop(js, std::move(mats));
+}
+
+Op json_to_op_superop(const json_t &js, std::vector<cmatrix_t> &&mats) {
   // Warning: we don't check superoperator is valid!
   Op op;
   op.type = OpType::superop;
   op.name = "superop";
   JSON::get_value(op.qubits, "qubits", js);
-  JSON::get_value(op.mats, "params", js);
+  op.mats = std::move(mats);
   // Check conditional
   add_condtional(Allowed::Yes, op, js);
   // Validation
@@ -885,12 +1114,16 @@ Op json_to_op_superop(const json_t &js) {
 }
 
 Op json_to_op_multiplexer(const json_t &js) {
+  std::vector<cmatrix_t> mats;
+  JSON::get_value(mats, "params", js);
+  return json_to_op_multiplexer(js, std::move(mats));
+}
+
+Op json_to_op_multiplexer(const json_t &js, std::vector<cmatrix_t> &&mats) {
   // Parse parameters
   reg_t qubits;
-  std::vector<cmatrix_t> mats;
   std::string label;
   JSON::get_value(qubits, "qubits", js);
-  JSON::get_value(mats, "params", js);
   JSON::get_value(label, "label", js);
   // Construct op
   auto op = make_multiplexer(qubits, mats, label);
@@ -900,11 +1133,17 @@ Op json_to_op_multiplexer(const json_t &js) {
 }
 
 Op json_to_op_kraus(const json_t &js) {
+  std::vector<cmatrix_t> mats;
+  JSON::get_value(mats, "params", js);
+  return json_to_op_kraus(js, std::move(mats));
+}
+
+Op json_to_op_kraus(const json_t &js, std::vector<cmatrix_t> &&mats) {
   Op op;
   op.type = OpType::kraus;
   op.name = "kraus";
   JSON::get_value(op.qubits, "qubits", js);
-  JSON::get_value(op.mats, "params", js);
+  op.mats = std::move(mats);
 
   // Validation
   check_empty_qubits(op);
@@ -925,6 +1164,21 @@ Op json_to_op_noise_switch(const json_t &js) {
   return op;
 }
 
+
+Op json_to_op_thermal_relaxation(const json_t &js) {
+  Op op;
+  op.type = OpType::thermal_relaxation;
+  op.name = "thermal_relaxation";
+  JSON::get_value(op.qubits, "qubits", js);
+  JSON::get_value(op.params, "params", js);
+
+  // Validation
+  check_thermal_relaxation(op);
+  // Conditional
+  add_condtional(Allowed::Yes, op, js);
+  return op;
+}
+
 //------------------------------------------------------------------------------
 // Implementation: Snapshot deserialization
 //------------------------------------------------------------------------------
@@ -23,6 +23,7 @@
 
 #include <complex>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -44,8 +45,10 @@ namespace nl = nlohmann;
 using namespace pybind11::literals;
 using json_t = nlohmann::json;
 
+#include "framework/qobj.hpp"
 #include "framework/results/result.hpp"
 #include "framework/results/data/average_data.hpp"
+#include "noise/noise_model.hpp"
 
 namespace std {
 
@@ -105,6 +108,73 @@ json_t numpy_to_json_3d(py::array_t<T, py::array::c_style> arr);
 
 } //end namespace JSON
 
+//------------------------------------------------------------------------------
+// Python -> Aer C++ Conversion
+//------------------------------------------------------------------------------
+
+namespace PyToAer {
+
+/**
+ * Convert a python matrix to a Matrix. A numpy array is copied with a single
+ * memcpy from a complex column-major buffer, which numpy only creates if the
+ * array has a different type or memory layout.
+ * @param obj is a 2-d numpy array, or a list of rows of JSON complex numbers
+ * @returns a Matrix
+ */
+AER::cmatrix_t to_matrix(const py::handle &obj);
+
+/**
+ * Convert a python list of matrices to a vector of Matrices
+ * @param obj is a list of matrices accepted by to_matrix
+ * @returns a vector of Matrices
+ */
+std::vector<AER::cmatrix_t> to_matrices(const py::handle &obj);
+
+/**
+ * Convert a python complex vector to a vector. A numpy array is copied
+ * from a complex buffer, which numpy only creates if the array has a
+ * different type or memory layout.
+ * @param obj is a 1-d numpy array, or a list of JSON complex numbers
+ * @returns a complex vector
+ */
+AER::cvector_t to_cvector(const py::handle &obj);
+
+/**
+ * Convert a python qobj instruction to an Op. Matrix and vector params are
+ * converted directly, and the other (small) fields of the instruction are
+ * converted through JSON.
+ * @param obj is a python dict of a qobj instruction
+ * @returns an Op
+ */
+AER::Operations::Op to_op(const py::handle &obj);
+
+/**
+ * Convert a python list of qobj instructions to Ops
+ * @param obj is a python list of instruction dicts
+ * @returns a vector of Ops
+ */
+std::vector<AER::Operations::Op> to_ops(const py::handle &obj);
+
+/**
+ * Convert a python noise model to a NoiseModel. The instructions of quantum
+ * errors are converted to Ops by to_op.
+ * @param obj is a python dict of a noise model, or None
+ * @returns a NoiseModel
+ */
+AER::Noise::NoiseModel to_noise_model(const py::handle &obj);
+
+/**
+ * Convert a python qobj to a Qobj. The instructions of the experiments are
+ * converted to Ops by to_op, and the "noise_model" of the qobj config is
+ * converted by to_noise_model instead of being stored in the config.
+ * @param obj is a python dict of a qobj
+ * @param noise_model is set to the noise model of the qobj config
+ * @returns a Qobj
+ */
+AER::Qobj to_qobj(const py::handle &obj, AER::Noise::NoiseModel &noise_model);
+
+} //end namespace PyToAer
+
 //------------------------------------------------------------------------------
 // Aer C++ -> Python Conversion
 //------------------------------------------------------------------------------
@@ -119,6 +189,32 @@ namespace AerToPy {
 template<typename T>
 py::object from_matrix(const matrix<T> &mat);
 
+/**
+ * Move a vector into a numpy array without copying its data.
+ * The array takes ownership of the data through a capsule.
+ * @param vec is a vector which is left empty
+ * @returns a 1-d numpy array
+ */
+template<typename T>
+py::array_t<T> to_numpy(std::vector<T> &&vec);
+
+/**
+ * Move a Matrix into a numpy array without copying its data.
+ * The array takes ownership of the data through a capsule.
+ * @param mat is a Matrix which is left empty
+ * @returns a 2-d numpy array with column-major strides
+ */
+template<typename T>
+py::array_t<T> to_numpy(matrix<T> &&mat);
+
+/**
+ * Move packed per-shot memory into a numpy array without copying its data.
+ * The array takes ownership of the data through a capsule.
+ * @param mem is a PackedMemory which is left empty
+ * @returns a 2-d uint8 numpy array with a row of packed bytes for each shot
+ */
+py::array_t<uint8_t> to_numpy(AER::PackedMemory &&mem);
+
 /**
  * Convert a AverageData to a python object
  * @param avg_data is an AverageData
@@ -127,34 +223,86 @@ py::object from_matrix(const matrix<T> &mat);
 template<typename T>
 py::dict from_avg_data(const AER::AverageData<T> &avg_data);
 
+/**
+ * Convert a AverageData of vectors to a python object, moving the mean
+ * into a numpy array
+ * @param avg_data is an AverageData which is left empty
+ * @returns a py::dict
+ */
+template<typename T>
+py::dict from_avg_data(AER::AverageData<std::vector<T>> &&avg_data);
+
+/**
+ * Convert a AverageData of Matrices to a python object, moving the mean
+ * into a numpy array
+ * @param avg_data is an AverageData which is left empty
+ * @returns a py::dict
+ */
+template<typename T>
+py::dict from_avg_data(AER::AverageData<matrix<T>> &&avg_data);
+
 /**
  * Convert a AverageSnapshot to a python object
- * @param avg_snap is an AverageSnapshot
+ * @param avg_snap is an AverageSnapshot which is left empty
  * @returns a py::dict
  */
 template<typename T>
-py::object from_avg_snap(const AER::AverageSnapshot<T> &avg_snap);
+py::object from_avg_snap(AER::AverageSnapshot<T> &&avg_snap);
+
+/**
+ * Convert a PershotSnapshot to a python object
+ * @param snap is a PershotSnapshot which is left empty
+ * @returns a py::dict
+ */
+template<typename T>
+py::object from_pershot_snap(AER::PershotSnapshot<T> &&snap);
+
+/**
+ * Convert a PershotSnapshot of vectors to a python object, moving each
+ * vector into a numpy array
+ * @param snap is a PershotSnapshot which is left empty
+ * @returns a py::dict
+ */
+template<typename T>
+py::object from_pershot_snap(AER::PershotSnapshot<std::vector<T>> &&snap);
+
+/**
+ * Convert a PershotSnapshot of Matrices to a python object, moving each
+ * matrix into a numpy array
+ * @param snap is a PershotSnapshot which is left empty
+ * @returns a py::dict
+ */
+template<typename T>
+py::object from_pershot_snap(AER::PershotSnapshot<matrix<T>> &&snap);
 
 /**
  * Convert an ExperimentData to a python object
- * @param result is an ExperimentData
+ * Vector and matrix data is moved into numpy arrays
+ * @param result is an ExperimentData which is left empty
  * @returns a py::dict
  */
-py::object from_exp_data(const AER::ExperimentData &result);
+py::object from_exp_data(AER::ExperimentData &&result);
 
 /**
  * Convert an ExperimentResult to a python object
- * @param result is an ExperimentResult
+ * @param result is an ExperimentResult which is left empty
  * @returns a py::dict
  */
-py::object from_exp_result(const AER::ExperimentResult &result);
+py::object from_exp_result(AER::ExperimentResult &&result);
 
 /**
  * Convert a Result to a python object
- * @param result is a Result
+ * @param result is a Result which is left empty
  * @returns a py::dict
  */
-py::object from_result(const AER::Result &result);
+py::object from_result(AER::Result &&result);
+
+/**
+ * Convert a serialized result to a python object
+ * @param result is a result serialized by JSON::serialize
+ * @returns a py::str for JSON text and py::bytes for binary formats
+ */
+py::object from_serialized(const std::string &result);
 
 } //end namespace AerToPy
 
@@ -332,6 +480,203 @@ void std::from_json(const json_t &js, py::object &o) {
 
 //------------------------------------------------------------------------------
 
+//============================================================================
+// Python Conversion to Simulator types
+//============================================================================
+
+AER::cmatrix_t PyToAer::to_matrix(const py::handle &obj) {
+  if (!py::isinstance<py::array>(obj)) {
+    json_t js = obj;
+    return js.get<AER::cmatrix_t>();
+  }
+  auto arr = py::array_t<AER::complex_t, py::array::f_style | py::array::forcecast>::ensure(obj);
+  if (!arr || arr.ndim() != 2) {
+    throw std::invalid_argument("Invalid matrix: not a 2-d complex array.");
+  }
+  // Matrices are stored in column-major order
+  AER::cmatrix_t mat(arr.shape(0), arr.shape(1));
+  std::memcpy(mat.GetMat(), arr.data(), sizeof(AER::complex_t) * arr.size());
+  return mat;
+}
+
+std::vector<AER::cmatrix_t> PyToAer::to_matrices(const py::handle &obj) {
+  if (!py::isinstance<py::list>(obj) && !py::isinstance<py::tuple>(obj) &&
+      !py::isinstance<py::array>(obj)) {
+    throw std::invalid_argument("Invalid matrix params: not a list of matrices.");
+  }
+  std::vector<AER::cmatrix_t> mats;
+  mats.reserve(py::len(obj));
+  for (py::handle mat : obj)
+    mats.push_back(to_matrix(mat));
+  return mats;
+}
+
+AER::cvector_t PyToAer::to_cvector(const py::handle &obj) {
+  if (!py::isinstance<py::array>(obj)) {
+    json_t js = obj;
+    return js.get<AER::cvector_t>();
+  }
+  auto arr = py::array_t<AER::complex_t, py::array::c_style | py::array::forcecast>::ensure(obj);
+  if (!arr || arr.ndim() != 1) {
+    throw std::invalid_argument("Invalid vector: not a 1-d complex array.");
+  }
+  return AER::cvector_t(arr.data(), arr.data() + arr.size());
+}
+
+AER::Operations::Op PyToAer::to_op(const py::handle &obj) {
+  if (!py::isinstance<py::dict>(obj)) {
+    throw std::invalid_argument("Invalid qobj instruction: not a dict.");
+  }
+  json_t js = json_t::object();
+  py::handle params;
+  for (auto item : py::reinterpret_borrow<py::dict>(obj)) {
+    const std::string key = item.first.cast<std::string>();
+    if (key == "params")
+      params = item.second;
+    else
+      js[key] = item.second;
+  }
+  if (params && !params.is_none()) {
+    std::string name;
+    JSON::get_value(name, "name", js);
+    if (AER::Operations::has_matrix_params(name))
+      return AER::Operations::json_to_op(js, to_matrices(params));
+    if (name == "initialize")
+      return AER::Operations::json_to_op_initialize(js, to_cvector(params));
+    js["params"] = params;
+  }
+  return AER::Operations::json_to_op(js);
+}
+
+std::vector<AER::Operations::Op> PyToAer::to_ops(const py::handle &obj) {
+  if (!py::isinstance<py::list>(obj) && !py::isinstance<py::tuple>(obj)) {
+    throw std::invalid_argument("Invalid qobj instructions: not a list.");
+  }
+  std::vector<AER::Operations::Op> ops;
+  ops.reserve(py::len(obj));
+  for (py::handle op : obj)
+    ops.push_back(to_op(op));
+  return ops;
+}
+
+AER::Noise::NoiseModel PyToAer::to_noise_model(const py::handle &obj) {
+  AER::Noise::NoiseModel noise_model;
+  if (obj.is_none())
+    return noise_model;
+  if (!py::isinstance<py::dict>(obj)) {
+    throw std::invalid_argument("Invalid noise_params JSON: not an object.");
+  }
+  // Load the fields other than the errors from JSON
+  json_t js = json_t::object();
+  py::handle errors;
+  for (auto item : py::reinterpret_borrow<py::dict>(obj)) {
+    const std::string key = item.first.cast<std::string>();
+    if (key == "errors")
+      errors = item.second;
+    else
+      js[key] = item.second;
+  }
+  noise_model.load_from_json(js);
+  if (!errors || errors.is_none())
+    return noise_model;
+  if (!py::isinstance<py::list>(errors) && !py::isinstance<py::tuple>(errors)) {
+    throw std::invalid_argument("Invalid noise_params JSON: \"error\" field is not a list");
+  }
+  for (py::handle error : errors) {
+    if (!py::isinstance<py::dict>(error)) {
+      throw std::invalid_argument("Invalid noise_params JSON: error is not an object.");
+    }
+    json_t error_js = json_t::object();
+    py::handle instructions;
+    for (auto item : py::reinterpret_borrow<py::dict>(error)) {
+      const std::string key = item.first.cast<std::string>();
+      if (key == "instructions")
+        instructions = item.second;
+      else
+        error_js[key] = item.second;
+    }
+    std::string type;
+    JSON::get_value(type, "type", error_js);
+    if (type != "qerror") {
+      if (instructions)
+        error_js["instructions"] = instructions;
+      noise_model.add_error_from_json(error_js);
+      continue;
+    }
+    std::vector<AER::Noise::NoiseModel::NoiseOps> circuits;
+    if (instructions && !instructions.is_none()) {
+      if (!py::isinstance<py::list>(instructions) &&
+          !py::isinstance<py::tuple>(instructions)) {
+        throw std::invalid_argument("Invalid quantum error: \"instructions\" is not a list.");
+      }
+      circuits.reserve(py::len(instructions));
+      for (py::handle circuit : instructions)
+        circuits.push_back(to_ops(circuit));
+    }
+    AER::rvector_t probs;
+    JSON::get_value(probs, "probabilities", error_js);
+    AER::Noise::QuantumError qerror;
+    qerror.set_circuits(circuits, probs);
+    noise_model.add_error_from_json(error_js, qerror);
+  }
+  return noise_model;
+}
+
+AER::Qobj PyToAer::to_qobj(const py::handle &obj,
+                           AER::Noise::NoiseModel &noise_model) {
+  if (!py::isinstance<py::dict>(obj)) {
+    throw std::invalid_argument("Invalid qobj: not a dict.");
+  }
+  // The qobj JSON with the content of the experiments list removed, and
+  // the experiments with the content of their instructions removed
+  json_t js = json_t::object();
+  std::vector<json_t> experiments;
+  std::vector<std::vector<AER::Operations::Op>> experiment_ops;
+  for (auto item : py::reinterpret_borrow<py::dict>(obj)) {
+    const std::string key = item.first.cast<std::string>();
+    if (key == "config" && py::isinstance<py::dict>(item.second)) {
+      json_t config = json_t::object();
+      for (auto field : py::reinterpret_borrow<py::dict>(item.second)) {
+        const std::string field_key = field.first.cast<std::string>();
+        if (field_key == "noise_model")
+          noise_model = to_noise_model(field.second);
+        else
+          config[field_key] = field.second;
+      }
+      js["config"] = std::move(config);
+    } else if (key == "experiments") {
+      if (!py::isinstance<py::list>(item.second) &&
+          !py::isinstance<py::tuple>(item.second)) {
+        throw std::invalid_argument(R"(Invalid qobj: "experiments" must be a list of objects.)");
+      }
+      js["experiments"] = json_t::array();
+      experiments.reserve(py::len(item.second));
+      experiment_ops.reserve(py::len(item.second));
+      for (py::handle experiment : item.second) {
+        if (!py::isinstance<py::dict>(experiment)) {
+          throw std::invalid_argument(R"(Invalid qobj: "experiments" must be a list of objects.)");
+        }
+        json_t experiment_js = json_t::object();
+        std::vector<AER::Operations::Op> ops;
+        for (auto field : py::reinterpret_borrow<py::dict>(experiment)) {
+          const std::string field_key = field.first.cast<std::string>();
+          if (field_key == "instructions") {
+            experiment_js["instructions"] = json_t::array();
+            ops = to_ops(field.second);
+          } else {
+            experiment_js[field_key] = field.second;
+          }
+        }
+        experiments.push_back(std::move(experiment_js));
+        experiment_ops.push_back(std::move(ops));
+      }
+    } else {
+      js[key] = item.second;
+    }
+  }
+  return AER::Qobj(js, std::move(experiments), std::move(experiment_ops));
+}
+
 //============================================================================
 // Pybind Conversion for Simulator types
 //============================================================================
@@ -353,6 +698,42 @@ py::object AerToPy::from_matrix(const matrix<T> &mat) {
   return py::cast(tbr);
 }
 
+template<typename T>
+py::array_t<T> AerToPy::to_numpy(std::vector<T> &&vec) {
+  auto ptr = new std::vector<T>(std::move(vec));
+  auto capsule = py::capsule(ptr, [](void *p) {
+    delete reinterpret_cast<std::vector<T>*>(p);
+  });
+  return py::array_t<T>(ptr->size(), ptr->data(), capsule);
+}
+
+template<typename T>
+py::array_t<T> AerToPy::to_numpy(matrix<T> &&mat) {
+  auto ptr = new matrix<T>(std::move(mat));
+  auto capsule = py::capsule(ptr, [](void *p) {
+    delete reinterpret_cast<matrix<T>*>(p);
+  });
+  // Matrices are stored in column-major order
+  std::vector<py::ssize_t> shape{static_cast<py::ssize_t>(ptr->GetRows()),
+                                 static_cast<py::ssize_t>(ptr->GetColumns())};
+  std::vector<py::ssize_t> strides{static_cast<py::ssize_t>(sizeof(T)),
+                                   static_cast<py::ssize_t>(sizeof(T) * ptr->GetLD())};
+  return py::array_t<T>(shape, strides, ptr->GetMat(), capsule);
+}
+
+py::array_t<uint8_t> AerToPy::to_numpy(AER::PackedMemory &&mem) {
+  auto ptr = new AER::PackedMemory(std::move(mem));
+  mem.clear();
+  auto capsule = py::capsule(ptr, [](void *p) {
+    delete reinterpret_cast<AER::PackedMemory*>(p);
+  });
+  // Shots are stored in row-major order
+  std::vector<py::ssize_t> shape{static_cast<py::ssize_t>(ptr->shots()),
+                                 static_cast<py::ssize_t>(ptr->num_bytes())};
+  std::vector<py::ssize_t> strides{static_cast<py::ssize_t>(ptr->num_bytes()), 1};
+  return py::array_t<uint8_t>(shape, strides, ptr->bytes().data(), capsule);
+}
+
 template<typename T> 
 py::dict AerToPy::from_avg_data(const AER::AverageData<T> &avg_data) {
   py::dict d;
@@ -363,14 +744,75 @@ py::dict AerToPy::from_avg_data(const AER::AverageData<T> &avg_data) {
   return d;
 }
 
+template<typename T>
+py::dict AerToPy::from_avg_data(AER::AverageData<std::vector<T>> &&avg_data) {
+  py::dict d;
+  if (avg_data.has_variance()) {
+    d["variance"] = AerToPy::to_numpy(avg_data.variance());
+  }
+  // Normalize the accumulated data in place to get the mean
+  if (avg_data.size() > 1)
+    AER::Linalg::idiv(avg_data.data(), double(avg_data.size()));
+  d["value"] = AerToPy::to_numpy(std::move(avg_data.data()));
+  avg_data.clear();
+  return d;
+}
+
+template<typename T>
+py::dict AerToPy::from_avg_data(AER::AverageData<matrix<T>> &&avg_data) {
+  py::dict d;
+  if (avg_data.has_variance()) {
+    d["variance"] = AerToPy::to_numpy(avg_data.variance());
+  }
+  // Normalize the accumulated data in place to get the mean
+  if (avg_data.size() > 1)
+    AER::Linalg::idiv(avg_data.data(), double(avg_data.size()));
+  d["value"] = AerToPy::to_numpy(std::move(avg_data.data()));
+  avg_data.clear();
+  return d;
+}
+
+template<typename T> 
+py::object AerToPy::from_pershot_snap(AER::PershotSnapshot<T> &&snap) {
+  py::dict d;
+  // string PershotData
+  for (auto &per_pair : snap.data())
+    d[per_pair.first.data()] = per_pair.second.data();
+  return d;
+}
+
+template<typename T> 
+py::object AerToPy::from_pershot_snap(AER::PershotSnapshot<std::vector<T>> &&snap) {
+  py::dict d;
+  for (auto &per_pair : snap.data()) {
+    py::list shots;
+    for (auto &vec : per_pair.second.data())
+      shots.append(AerToPy::to_numpy(std::move(vec)));
+    d[per_pair.first.data()] = shots;
+  }
+  return d;
+}
+
 template<typename T> 
-py::object AerToPy::from_avg_snap(const AER::AverageSnapshot<T> &avg_snap) {
+py::object AerToPy::from_pershot_snap(AER::PershotSnapshot<matrix<T>> &&snap) {
   py::dict d;
-  for (const auto &outer_pair : avg_snap.data()) {
+  for (auto &per_pair : snap.data()) {
+    py::list shots;
+    for (auto &mat : per_pair.second.data())
+      shots.append(AerToPy::to_numpy(std::move(mat)));
+    d[per_pair.first.data()] = shots;
+  }
+  return d;
+}
+
+template<typename T> 
+py::object AerToPy::from_avg_snap(AER::AverageSnapshot<T> &&avg_snap) {
+  py::dict d;
+  for (auto &outer_pair : avg_snap.data()) {
     py::list d1;
-    for (const auto &inner_pair : outer_pair.second) {
+    for (auto &inner_pair : outer_pair.second) {
       // Store mean and variance for snapshot
-      py::dict datum = AerToPy::from_avg_data(inner_pair.second);
+      py::dict datum = AerToPy::from_avg_data(std::move(inner_pair.second));
       // Add memory key if there are classical registers
       auto memory = inner_pair.first;
       if ( ! memory.empty()) datum["memory"] = inner_pair.first;
@@ -382,14 +824,18 @@ py::object AerToPy::from_avg_snap(const AER::AverageSnapshot<T> &avg_snap) {
   return d;
 }
 
-py::object AerToPy::from_exp_data(const AER::ExperimentData &result) {
+py::object AerToPy::from_exp_data(AER::ExperimentData &&result) {
   py::dict pyresult;
 
   // Measure data
   if (result.return_counts_ && ! result.counts_.empty())
-    pyresult["counts"] = result.counts_;
-  if (result.return_memory_ && ! result.memory_.empty())
-    pyresult["memory"] = result.memory_;
+    pyresult["counts"] = result.counts_.hex_counts();
+  if (result.return_memory_ && ! result.memory_.empty()) {
+    if (result.return_packed_memory_)
+      pyresult["memory"] = AerToPy::to_numpy(std::move(result.memory_));
+    else
+      pyresult["memory"] = result.memory_.hex();
+  }
   if (result.return_register_ && ! result.register_.empty())
     pyresult["register"] = result.register_;
 
@@ -399,11 +845,11 @@ py::object AerToPy::from_exp_data(const AER::ExperimentData &result) {
     from_json(pair.second, tmp);
     pyresult[pair.first.data()] = tmp;
   }
-  for (const auto &pair : result.additional_cvector_data_) {
-    pyresult[pair.first.data()] = pair.second;
+  for (auto &pair : result.additional_cvector_data_) {
+    pyresult[pair.first.data()] = AerToPy::to_numpy(std::move(pair.second));
   }
-  for (const auto &pair : result.additional_cmatrix_data_) {
-    pyresult[pair.first.data()] = AerToPy::from_matrix(pair.second);    
+  for (auto &pair : result.additional_cmatrix_data_) {
+    pyresult[pair.first.data()] = AerToPy::to_numpy(std::move(pair.second));
   }
 
   // Snapshot data
@@ -416,19 +862,19 @@ py::object AerToPy::from_exp_data(const AER::ExperimentData &result) {
       snapshots[pair.first.data()] = tmp;
     }
     for (auto &pair : result.average_complex_snapshots_) {
-      snapshots[pair.first.data()] = AerToPy::from_avg_snap(pair.second);
+      snapshots[pair.first.data()] = AerToPy::from_avg_snap(std::move(pair.second));
     }
     for (auto &pair : result.average_cvector_snapshots_) {
-      snapshots[pair.first.data()] = AerToPy::from_avg_snap(pair.second);
+      snapshots[pair.first.data()] = AerToPy::from_avg_snap(std::move(pair.second));
     }
     for (auto &pair : result.average_cmatrix_snapshots_) {
-      snapshots[pair.first.data()] = AerToPy::from_avg_snap(pair.second);
+      snapshots[pair.first.data()] = AerToPy::from_avg_snap(std::move(pair.second));
     }
     for (auto &pair : result.average_cmap_snapshots_) {
-      snapshots[pair.first.data()] = AerToPy::from_avg_snap(pair.second);
+      snapshots[pair.first.data()] = AerToPy::from_avg_snap(std::move(pair.second));
     }
     for (auto &pair : result.average_rmap_snapshots_) {
-      snapshots[pair.first.data()] = AerToPy::from_avg_snap(pair.second);
+      snapshots[pair.first.data()] = AerToPy::from_avg_snap(std::move(pair.second));
     }
     // Singleshot snapshot data
     // Note these will override the average snapshots
@@ -439,39 +885,19 @@ py::object AerToPy::from_exp_data(const AER::ExperimentData &result) {
       snapshots[pair.first.data()] = tmp;
     }
     for (auto &pair : result.pershot_complex_snapshots_) {
-      py::dict d;
-      // string PershotData
-      for (auto &per_pair : pair.second.data())
-        d[per_pair.first.data()] = per_pair.second.data();
-      snapshots[pair.first.data()] = d;
+      snapshots[pair.first.data()] = AerToPy::from_pershot_snap(std::move(pair.second));
     }
     for (auto &pair : result.pershot_cvector_snapshots_) {
-      py::dict d;
-      // string PershotData
-      for (auto &per_pair : pair.second.data())
-        d[per_pair.first.data()] = per_pair.second.data();
-      snapshots[pair.first.data()] = d;
+      snapshots[pair.first.data()] = AerToPy::from_pershot_snap(std::move(pair.second));
     }
     for (auto &pair : result.pershot_cmatrix_snapshots_) {
-      py::dict d;
-      // string PershotData
-      for (auto &per_pair : pair.second.data())
-        d[per_pair.first.data()] = per_pair.second.data();
-      snapshots[pair.first.data()] = d;
+      snapshots[pair.first.data()] = AerToPy::from_pershot_snap(std::move(pair.second));
     }
     for (auto &pair : result.pershot_cmap_snapshots_) {
-      py::dict d;
-      // string PershotData
-      for (auto &per_pair : pair.second.data())
-        d[per_pair.first.data()] = per_pair.second.data();
-      snapshots[pair.first.data()] = d;
+      snapshots[pair.first.data()] = AerToPy::from_pershot_snap(std::move(pair.second));
     }
     for (auto &pair : result.pershot_rmap_snapshots_) {
-      py::dict d;
-      // string PershotData
-      for (auto &per_pair : pair.second.data())
-        d[per_pair.first.data()] = per_pair.second.data();
-      snapshots[pair.first.data()] = d;
+      snapshots[pair.first.data()] = AerToPy::from_pershot_snap(std::move(pair.second));
     }
     if ( py::len(snapshots) != 0 )
         pyresult["snapshots"] = snapshots;
@@ -481,13 +907,13 @@ py::object AerToPy::from_exp_data(const AER::ExperimentData &result) {
   return pyresult;
 }
 
-py::object AerToPy::from_exp_result(const AER::ExperimentResult &result) {
+py::object AerToPy::from_exp_result(AER::ExperimentResult &&result) {
   py::dict pyresult;
 
   pyresult["shots"] = result.shots;
   pyresult["seed_simulator"] = result.seed;
 
-  pyresult["data"] = AerToPy::from_exp_data(result.data);
+  pyresult["data"] = AerToPy::from_exp_data(std::move(result.data));
 
   pyresult["success"] = (result.status == AER::ExperimentResult::Status::completed);
   switch (result.status) {
@@ -515,7 +941,7 @@ py::object AerToPy::from_exp_result(const AER::ExperimentResult &result) {
 
 }
 
-py::object AerToPy::from_result(const AER::Result &result) {
+py::object AerToPy::from_result(AER::Result &&result) {
   py::dict pyresult;
   pyresult["qobj_id"] = result.qobj_id;
 
@@ -525,8 +951,8 @@ py::object AerToPy::from_result(const AER::Result &result) {
   pyresult["job_id"] = result.job_id;
 
   py::list exp_results;
-  for( const AER::ExperimentResult& exp : result.results)
-    exp_results.append(AerToPy::from_exp_result(exp));
+  for(AER::ExperimentResult& exp : result.results)
+    exp_results.append(AerToPy::from_exp_result(std::move(exp)));
   pyresult["results"] = exp_results;
 
   // For header and metadata we continue using the json->pyobject casting
@@ -559,4 +985,12 @@ py::object AerToPy::from_result(const AER::Result &result) {
 
 }
 
+py::object AerToPy::from_serialized(const std::string &result) {
+  // Results are JSON objects, which start with '{' in JSON text but not in
+  // the MessagePack or CBOR encodings
+  if (!result.empty() && result[0] == '{')
+    return py::str(result);
+  return py::bytes(result);
+}
+
 #endif
@@ -15,11 +15,17 @@
 #ifndef _aer_framework_qobj_hpp_
 #define _aer_framework_qobj_hpp_
 
+#include <algorithm>
+#include <exception>
 #include <iostream>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "framework/circuit.hpp"
 
 namespace AER {
@@ -38,9 +44,33 @@ public:
   Qobj() = default;
   virtual ~Qobj() = default;
 
+  // Copy and move constructors and assignment
+  Qobj(const Qobj &) = default;
+  Qobj(Qobj &&) = default;
+  Qobj &operator=(const Qobj &) = default;
+  Qobj &operator=(Qobj &&) = default;
+
   // JSON deserialization constructor
   Qobj(const json_t &js);
 
+  // Parse a qobj from JSON text given as a string or an input stream.
+  // The instructions of each experiment are converted to ops as they are
+  // parsed, so the JSON document of the whole qobj is never stored. The
+  // optional extra config values are added to the qobj config, replacing
+  // existing values, before the circuits are constructed.
+  template <class input_t>
+  static Qobj parse(input_t &&input, const json_t &extra_config = json_t());
+
+  // Construct a qobj from its JSON with the content of the experiments list
+  // removed, the JSON of each experiment with the content of its
+  // instructions removed, and the ops already converted from the
+  // instructions of each experiment.
+  // The optional extra config values are added to the qobj config,
+  // replacing existing values, before the circuits are constructed.
+  Qobj(const json_t &js, std::vector<json_t> &&experiments,
+       std::vector<std::vector<Operations::Op>> &&experiment_ops,
+       const json_t &extra_config = json_t());
+
   //----------------------------------------------------------------
   // Data
   //----------------------------------------------------------------
@@ -49,6 +79,22 @@ public:
   std::vector<Circuit> circuits;  // List of circuits
   json_t header;                  // (optional) passed through to result
   json_t config;                  // (optional) qobj level config data
+
+private:
+  // Load the qobj fields other than the experiments
+  void load_fields(const json_t &js);
+
+  // Set fixed seeds of the circuits if the config has a simulator seed
+  void set_seeds();
+
+  // Construct the circuit of each of num_circuits experiments as
+  // load_circuit(j). Experiments are loaded in parallel if there are at
+  // least parallel_threshold_ of them.
+  template <class load_t>
+  void load_circuits(size_t num_circuits, load_t &&load_circuit);
+
+  // Minimum number of experiments for loading circuits in parallel
+  static const size_t parallel_threshold_ = 16;
 };
 
 
@@ -60,6 +106,94 @@ public:
 inline void from_json(const json_t &js, Qobj &qobj) {qobj = Qobj(js);}
 
 Qobj::Qobj(const json_t &js) {
+  load_fields(js);
+
+  // Parse experiments
+  const json_t &circs = js["experiments"];
+  if (!circs.is_array()) {
+    throw std::invalid_argument(R"(Invalid qobj: "experiments" must be a list of objects.)");
+  }
+  load_circuits(circs.size(), [&](size_t j) {
+    return Circuit(circs[j], config);
+  });
+  set_seeds();
+}
+
+template <class input_t>
+Qobj Qobj::parse(input_t &&input, const json_t &extra_config) {
+  // The experiments with the content of their instructions removed, and
+  // the ops converted from the instructions of each experiment
+  std::vector<json_t> experiments;
+  std::vector<std::vector<Operations::Op>> experiment_ops;
+
+  // Keys of the current qobj and experiment fields
+  std::string qobj_key;
+  std::string experiment_key;
+
+  // The qobj is at depth 0, its experiments at depth 2 and their
+  // instructions at depth 4. Returning false discards a parsed value.
+  json_t::parser_callback_t callback = [&](int depth,
+                                           json_t::parse_event_t event,
+                                           json_t &parsed) {
+    switch (event) {
+      case json_t::parse_event_t::key:
+        if (depth == 1)
+          qobj_key = parsed.get<std::string>();
+        else if (depth == 3)
+          experiment_key = parsed.get<std::string>();
+        return true;
+      case json_t::parse_event_t::object_start:
+        if (depth == 2 && qobj_key == "experiments") {
+          experiment_ops.emplace_back();
+          experiment_key.clear();
+        }
+        return true;
+      case json_t::parse_event_t::object_end:
+        if (qobj_key != "experiments")
+          return true;
+        if (depth == 4 && experiment_key == "instructions") {
+          experiment_ops.back().emplace_back(Operations::json_to_op(parsed));
+          return false;
+        }
+        if (depth == 2) {
+          experiments.emplace_back(std::move(parsed));
+          return false;
+        }
+        return true;
+      default:
+        return true;
+    }
+  };
+  const json_t js = json_t::parse(std::forward<input_t>(input), callback);
+
+  Qobj qobj(js, std::move(experiments), std::move(experiment_ops),
+            extra_config);
+  // Every experiment has been removed from the parsed JSON
+  if (!js["experiments"].is_array() || !js["experiments"].empty()) {
+    throw std::invalid_argument(R"(Invalid qobj: "experiments" must be a list of objects.)");
+  }
+  return qobj;
+}
+
+Qobj::Qobj(const json_t &js, std::vector<json_t> &&experiments,
+           std::vector<std::vector<Operations::Op>> &&experiment_ops,
+           const json_t &extra_config) {
+  load_fields(js);
+  if (experiments.size() != experiment_ops.size()) {
+    throw std::invalid_argument("Invalid qobj: experiments don't match their instructions.");
+  }
+  for (auto it = extra_config.begin(); it != extra_config.end(); ++it) {
+    config[it.key()] = it.value();
+  }
+  load_circuits(experiments.size(), [&](size_t j) {
+    return Circuit(std::move(experiment_ops[j]), experiments[j], config);
+  });
+  experiments.clear();
+  experiment_ops.clear();
+  set_seeds();
+}
+
+void Qobj::load_fields(const json_t &js) {
   // Check required fields
   if (JSON::get_value(id, "qobj_id", js) == false) {
     throw std::invalid_argument(R"(Invalid qobj: no "qobj_id" field)");
@@ -75,7 +209,40 @@ Qobj::Qobj(const json_t &js) {
   // Get header and config;
   JSON::get_value(config, "config", js);
   JSON::get_value(header, "header", js);
+}
 
+template <class load_t>
+void Qobj::load_circuits(size_t num_circuits, load_t &&load_circuit) {
+  int num_threads = 1;
+#ifdef _OPENMP
+  if (num_circuits >= parallel_threshold_) {
+    int max_threads = 0;
+    JSON::get_value(max_threads, "max_parallel_threads", config);
+    num_threads = omp_get_max_threads();
+    if (max_threads > 0)
+      num_threads = std::min(num_threads, max_threads);
+  }
+#endif
+  circuits.clear();
+  circuits.resize(num_circuits);
+  // Exceptions can't leave a parallel region, so the error of the first
+  // invalid experiment is rethrown after all experiments are loaded
+  std::vector<std::exception_ptr> errors(num_circuits);
+  #pragma omp parallel for if (num_threads > 1) num_threads(num_threads)
+  for (int_t j = 0; j < static_cast<int_t>(num_circuits); ++j) {
+    try {
+      circuits[j] = load_circuit(j);
+    } catch (...) {
+      errors[j] = std::current_exception();
+    }
+  }
+  for (const auto &error : errors) {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+
+void Qobj::set_seeds() {
   // Check for fixed simulator seed
   // If seed is negative a random seed will be chosen for each
   // experiment. Otherwise each experiment will be set to a fixed
@@ -84,10 +251,7 @@ Qobj::Qobj(const json_t &js) {
   uint_t seed_shift = 0;
   JSON::get_value(seed, "seed_simulator", config);
 
-  // Parse experiments
-  const json_t &circs = js["experiments"];
-  for (const auto &circ : circs) {
-    Circuit circuit(circ, config);
+  for (auto &circuit : circuits) {
     // Override random seed with fixed seed if set
     // We shift the seed for each successive experiment
     // So that results aren't correlated between experiments
@@ -95,7 +259,6 @@ Qobj::Qobj(const json_t &js) {
       circuit.set_seed(seed + seed_shift);
       seed_shift += 2113; // Shift the seed
     }
-    circuits.push_back(circuit);
   }
 }
 
@@ -70,6 +70,14 @@ class AverageData {
   // Return bool for in the container can compute variance
   bool has_variance() const { return variance_; }
 
+  // Return the raw accumulators as JSON for checkpointing.
+  // Unlike `to_json` this is lossless and can be restored
+  // with `load_checkpoint`.
+  json_t checkpoint() const;
+
+  // Restore the accumulators from a checkpoint JSON
+  void load_checkpoint(const json_t &js);
+
  protected:
   // Accumulated data
   T accum_;
@@ -215,6 +223,29 @@ void AverageData<T>::add_data(T &&datum, bool compute_variance) noexcept {
   count_ += 1;
 }
 
+template <typename T>
+json_t AverageData<T>::checkpoint() const {
+  json_t js;
+  js["count"] = count_;
+  js["accum"] = accum_;
+  js["variance"] = variance_;
+  if (variance_) {
+    js["accum_squared"] = accum_squared_;
+  }
+  return js;
+}
+
+template <typename T>
+void AverageData<T>::load_checkpoint(const json_t &js) {
+  clear();
+  count_ = js["count"].get<size_t>();
+  accum_ = js["accum"].get<T>();
+  variance_ = js["variance"].get<bool>();
+  if (variance_) {
+    accum_squared_ = js["accum_squared"].get<T>();
+  }
+}
+
 //------------------------------------------------------------------------------
 // JSON serialization
 //------------------------------------------------------------------------------
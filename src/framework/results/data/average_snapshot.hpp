@@ -58,11 +58,17 @@ class AverageSnapshot {
   bool empty() const { return data_.empty(); }
 
   // Return data reference
-  stringmap_t<stringmap_t<AverageData<T>>> data() { return data_; }
+  stringmap_t<stringmap_t<AverageData<T>>> &data() { return data_; }
 
   // Return const data reference
   const stringmap_t<stringmap_t<AverageData<T>>> &data() const { return data_; }
 
+  // Return lossless JSON of the snapshot accumulators for checkpointing
+  json_t checkpoint() const;
+
+  // Restore snapshot accumulators from a checkpoint JSON
+  void load_checkpoint(const json_t &js);
+
  protected:
   // Internal Storage
   // Outer map key is the snapshot label string
@@ -99,6 +105,12 @@ void AverageSnapshot<T>::combine(const AverageSnapshot<T> &other) {
 
 template <typename T>
 void AverageSnapshot<T>::combine(AverageSnapshot<T> &&other) noexcept {
+  // If empty we take ownership of the other snapshots storage
+  if (data_.empty()) {
+    data_ = std::move(other.data_);
+    other.clear();
+    return;
+  }
   for (auto &outer : other.data_) {
     for (auto &inner : outer.second) {
       data_[outer.first][inner.first].combine(std::move(inner.second));
@@ -108,6 +120,28 @@ void AverageSnapshot<T>::combine(AverageSnapshot<T> &&other) noexcept {
   other.clear();  
 }
 
+template <typename T>
+json_t AverageSnapshot<T>::checkpoint() const {
+  json_t js = json_t::object();
+  for (const auto &outer : data_) {
+    for (const auto &inner : outer.second) {
+      js[outer.first][inner.first] = inner.second.checkpoint();
+    }
+  }
+  return js;
+}
+
+template <typename T>
+void AverageSnapshot<T>::load_checkpoint(const json_t &js) {
+  clear();
+  for (auto outer = js.begin(); outer != js.end(); ++outer) {
+    for (auto inner = outer.value().begin(); inner != outer.value().end();
+         ++inner) {
+      data_[outer.key()][inner.key()].load_checkpoint(inner.value());
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 // JSON serialization
 //------------------------------------------------------------------------------
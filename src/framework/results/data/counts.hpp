@@ -0,0 +1,177 @@
+/**
+ * This code is part of Qiskit.
+ *
+ * (C) Copyright IBM 2018, 2019, 2020.
+ *
+ * This code is licensed under the Apache License, Version 2.0. You may
+ * obtain a copy of this license in the LICENSE.txt file in the root directory
+ * of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Any modifications or derivative works of this code must retain this
+ * copyright notice, and modified files need to carry a notice indicating
+ * that they have been altered from the originals.
+ */
+
+#ifndef _aer_framework_results_data_counts_hpp_
+#define _aer_framework_results_data_counts_hpp_
+
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "framework/types.hpp"
+#include "framework/utils.hpp"
+
+namespace AER {
+
+//------------------------------------------------------------------------------
+// Counts data storage class
+//------------------------------------------------------------------------------
+
+// Histogram of the memory values of shots. Memory values are keyed by their
+// integer value, or by their 64-bit words with the least significant word
+// first if they have more than 64 bits, and are only converted to hex
+// strings for output.
+
+class Counts {
+ public:
+  // Add a number of shots of a memory value of at most 64 bits
+  void add(uint_t memory, uint_t count = 1) { counts_[memory] += count; }
+
+  // Add a number of shots of a num_memory bit memory value given by its
+  // 64-bit words. Memory values without bits are ignored.
+  void add(const reg_t &memory, uint_t num_memory, uint_t count = 1);
+
+  // Add a number of shots of a memory value given as a hex string.
+  // Empty memory values are ignored.
+  void add(const std::string &memory_hex, uint_t count = 1);
+
+  // Combine with another counts container
+  void combine(const Counts &other);
+
+  // Clear all counts
+  void clear();
+
+  // Return true if there are no counts
+  bool empty() const {
+    return counts_.empty() && words_counts_.empty() && hex_counts_.empty();
+  }
+
+  // Return the counts keyed by the hex string of each memory value
+  std::map<std::string, uint_t> hex_counts() const;
+
+  // Return the number of shots of each memory value
+  std::vector<uint_t> values() const;
+
+ protected:
+  struct WordsHash {
+    size_t operator()(const reg_t &words) const {
+      size_t seed = words.size();
+      for (const auto &word : words)
+        seed ^= std::hash<uint_t>()(word) + 0x9e3779b9 + (seed << 6) +
+                (seed >> 2);
+      return seed;
+    }
+  };
+
+  // Memory values of at most 64 bits
+  std::unordered_map<uint_t, uint_t> counts_;
+
+  // Memory values of more than 64 bits, which all have num_memory_ bits
+  std::unordered_map<reg_t, uint_t, WordsHash> words_counts_;
+  uint_t num_memory_ = 0;
+
+  // Memory values added as hex strings that don't fit in 64 bits
+  std::map<std::string, uint_t> hex_counts_;
+};
+
+//------------------------------------------------------------------------------
+// Implementation
+//------------------------------------------------------------------------------
+
+void Counts::add(const reg_t &memory, uint_t num_memory, uint_t count) {
+  if (num_memory == 0)
+    return;
+  if (num_memory <= 64) {
+    counts_[memory.empty() ? 0 : memory[0]] += count;
+    return;
+  }
+  if (!words_counts_.empty() && num_memory != num_memory_) {
+    throw std::invalid_argument(
+        "Counts: memory values have different numbers of bits.");
+  }
+  num_memory_ = num_memory;
+  words_counts_[memory] += count;
+}
+
+void Counts::add(const std::string &memory_hex, uint_t count) {
+  if (memory_hex.empty())
+    return;
+  const size_t digits = (memory_hex.compare(0, 2, "0x") == 0)
+                            ? memory_hex.size() - 2
+                            : memory_hex.size();
+  if (digits <= 16) {
+    counts_[std::stoull(memory_hex, nullptr, 16)] += count;
+  } else {
+    hex_counts_[memory_hex] += count;
+  }
+}
+
+void Counts::combine(const Counts &other) {
+  for (const auto &pair : other.counts_)
+    counts_[pair.first] += pair.second;
+  if (!other.words_counts_.empty()) {
+    if (!words_counts_.empty() && other.num_memory_ != num_memory_) {
+      throw std::invalid_argument(
+          "Counts: memory values have different numbers of bits.");
+    }
+    num_memory_ = other.num_memory_;
+    for (const auto &pair : other.words_counts_)
+      words_counts_[pair.first] += pair.second;
+  }
+  for (const auto &pair : other.hex_counts_)
+    hex_counts_[pair.first] += pair.second;
+}
+
+void Counts::clear() {
+  counts_.clear();
+  words_counts_.clear();
+  num_memory_ = 0;
+  hex_counts_.clear();
+}
+
+std::map<std::string, uint_t> Counts::hex_counts() const {
+  std::map<std::string, uint_t> result = hex_counts_;
+  for (const auto &pair : counts_)
+    result[Utils::int2hex(pair.first)] += pair.second;
+  for (const auto &pair : words_counts_) {
+    // Pad to the words of num_memory bits so that the hex string is the
+    // same as for a classical register of num_memory bits
+    reg_t words = pair.first;
+    words.resize((num_memory_ + 63) / 64, 0);
+    result[Utils::words2hex(words)] += pair.second;
+  }
+  return result;
+}
+
+std::vector<uint_t> Counts::values() const {
+  std::vector<uint_t> result;
+  if (!hex_counts_.empty() || !words_counts_.empty()) {
+    // Values added in different forms may be the same memory value
+    for (const auto &pair : hex_counts())
+      result.push_back(pair.second);
+    return result;
+  }
+  result.reserve(counts_.size());
+  for (const auto &pair : counts_)
+    result.push_back(pair.second);
+  return result;
+}
+
+//------------------------------------------------------------------------------
+} // end namespace AER
+//------------------------------------------------------------------------------
+#endif
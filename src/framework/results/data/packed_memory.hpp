@@ -0,0 +1,166 @@
+/**
+ * This code is part of Qiskit.
+ *
+ * (C) Copyright IBM 2018, 2019, 2020.
+ *
+ * This code is licensed under the Apache License, Version 2.0. You may
+ * obtain a copy of this license in the LICENSE.txt file in the root directory
+ * of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Any modifications or derivative works of this code must retain this
+ * copyright notice, and modified files need to carry a notice indicating
+ * that they have been altered from the originals.
+ */
+
+#ifndef _aer_framework_results_data_packed_memory_hpp_
+#define _aer_framework_results_data_packed_memory_hpp_
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "framework/types.hpp"
+#include "framework/utils.hpp"
+
+namespace AER {
+
+//------------------------------------------------------------------------------
+// Packed per-shot memory storage class
+//------------------------------------------------------------------------------
+
+// Memory values of each shot packed into a shots x num_bytes row-major byte
+// matrix, where num_bytes = ceil(num_bits / 8). Bit j of the memory of a shot
+// is bit j % 8 of byte j / 8 of its row. Hex strings of the memory values are
+// only generated on request.
+
+class PackedMemory {
+ public:
+  // Add the memory value of a shot given by its 64-bit words with the least
+  // significant word first. All shots must have the same number of bits.
+  void add(const reg_t &memory, uint_t num_bits);
+
+  // Combine with another packed memory container
+  void combine(const PackedMemory &other);
+  void combine(PackedMemory &&other);
+
+  // Reserve storage for a number of shots. If there are no shots yet the
+  // storage is reserved when the first shot is added.
+  void reserve(uint_t shots);
+
+  // Clear all shots
+  void clear();
+
+  // Return true if there are no shots
+  bool empty() const { return shots_ == 0; }
+
+  // Return the number of shots
+  uint_t shots() const { return shots_; }
+
+  // Return the number of memory bits of each shot
+  uint_t num_bits() const { return num_bits_; }
+
+  // Return the number of bytes of each shot
+  uint_t num_bytes() const { return (num_bits_ + 7) / 8; }
+
+  // Access the packed bytes of all shots
+  std::vector<uint8_t> &bytes() { return bytes_; }
+  const std::vector<uint8_t> &bytes() const { return bytes_; }
+
+  // Return the memory value of a shot as 64-bit words with the least
+  // significant word first
+  reg_t words(uint_t shot) const;
+
+  // Return the memory value of a shot as a hex string
+  std::string hex(uint_t shot) const { return Utils::words2hex(words(shot)); }
+
+  // Return the memory values of all shots as hex strings
+  std::vector<std::string> hex() const;
+
+ protected:
+  uint_t num_bits_ = 0;
+  uint_t shots_ = 0;
+  uint_t reserved_shots_ = 0;
+  std::vector<uint8_t> bytes_;
+};
+
+//------------------------------------------------------------------------------
+// Implementation
+//------------------------------------------------------------------------------
+
+void PackedMemory::add(const reg_t &memory, uint_t num_bits) {
+  if (shots_ == 0) {
+    num_bits_ = num_bits;
+    bytes_.reserve(reserved_shots_ * num_bytes());
+  } else if (num_bits != num_bits_) {
+    throw std::invalid_argument(
+        "PackedMemory: memory values have different numbers of bits.");
+  }
+  const uint_t nbytes = num_bytes();
+  for (uint_t j = 0; j < nbytes; ++j) {
+    const uint_t word = j / 8;
+    bytes_.push_back((word < memory.size())
+                         ? static_cast<uint8_t>(memory[word] >> (8 * (j % 8)))
+                         : 0);
+  }
+  shots_++;
+}
+
+void PackedMemory::combine(const PackedMemory &other) {
+  if (other.empty())
+    return;
+  if (empty()) {
+    *this = other;
+    return;
+  }
+  if (other.num_bits_ != num_bits_) {
+    throw std::invalid_argument(
+        "PackedMemory: memory values have different numbers of bits.");
+  }
+  bytes_.insert(bytes_.end(), other.bytes_.begin(), other.bytes_.end());
+  shots_ += other.shots_;
+}
+
+void PackedMemory::combine(PackedMemory &&other) {
+  if (empty()) {
+    *this = std::move(other);
+    other.clear();
+    return;
+  }
+  combine(static_cast<const PackedMemory &>(other));
+  other.clear();
+}
+
+void PackedMemory::reserve(uint_t shots) {
+  reserved_shots_ = shots;
+  if (shots_ > 0)
+    bytes_.reserve(shots * num_bytes());
+}
+
+void PackedMemory::clear() {
+  num_bits_ = 0;
+  shots_ = 0;
+  bytes_.clear();
+}
+
+reg_t PackedMemory::words(uint_t shot) const {
+  const uint_t nbytes = num_bytes();
+  reg_t ret((num_bits_ + 63) / 64, 0);
+  const uint8_t *row = bytes_.data() + shot * nbytes;
+  for (uint_t j = 0; j < nbytes; ++j)
+    ret[j / 8] |= static_cast<uint_t>(row[j]) << (8 * (j % 8));
+  return ret;
+}
+
+std::vector<std::string> PackedMemory::hex() const {
+  std::vector<std::string> ret;
+  ret.reserve(shots_);
+  for (uint_t shot = 0; shot < shots_; ++shot)
+    ret.push_back(hex(shot));
+  return ret;
+}
+
+//------------------------------------------------------------------------------
+} // end namespace AER
+//------------------------------------------------------------------------------
+#endif
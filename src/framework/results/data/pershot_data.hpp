@@ -51,6 +51,7 @@ class PershotData {
   // Get number of datum accumulated
   size_t size() const { return data_.size(); }
 
+  // Reserve storage for a number of shots of data
   void reserve(size_t sz) { data_.reserve(sz); }
 
   // Clear all stored data
@@ -77,9 +78,15 @@ void PershotData<T>::combine(const PershotData<T>& other) {
 
 template <typename T>
 void PershotData<T>::combine(PershotData<T>&& other) noexcept {
-  // Move data from other container
-  data_.insert(data_.end(), std::make_move_iterator(other.data_.begin()),
-               std::make_move_iterator(other.data_.end()));
+  // If empty we take ownership of the other containers storage
+  if (data_.empty()) {
+    data_ = std::move(other.data_);
+  } else {
+    // Move data from other container
+    data_.insert(data_.end(), std::make_move_iterator(other.data_.begin()),
+                 std::make_move_iterator(other.data_.end()));
+  }
+  other.clear();
 }
 
 //------------------------------------------------------------------------------
@@ -55,16 +55,28 @@ class PershotSnapshot {
   // Return true if snapshot container is empty
   bool empty() const { return data_.empty(); }
 
+  // Reserve storage for a number of shots for each snapshot label
+  void reserve(size_t num_shots) { reserve_ = num_shots; }
+
   // Return data reference
-  stringmap_t<PershotData<T>> data() { return data_; }
+  stringmap_t<PershotData<T>> &data() { return data_; }
 
   // Return const data reference
   const stringmap_t<PershotData<T>> &data() const { return data_; }
 
+  // Return lossless JSON of the snapshot data for checkpointing
+  json_t checkpoint() const;
+
+  // Restore snapshot data from a checkpoint JSON
+  void load_checkpoint(const json_t &js);
+
  private:
   // Internal Storage
   // Map key is the snapshot label string
   stringmap_t<PershotData<T>> data_;
+
+  // Number of shots to reserve when a new snapshot label is added
+  size_t reserve_ = 0;
 };
 
 //------------------------------------------------------------------------------
@@ -73,12 +85,18 @@ class PershotSnapshot {
 
 template <typename T>
 void PershotSnapshot<T>::add_data(const std::string &key, const T &datum) {
-  data_[key].add_data(datum);
+  auto &data = data_[key];
+  if (data.empty())
+    data.reserve(reserve_);
+  data.add_data(datum);
 }
 
 template <typename T>
 void PershotSnapshot<T>::add_data(const std::string &key, T &&datum) noexcept {
-  data_[key].add_data(std::move(datum));
+  auto &data = data_[key];
+  if (data.empty())
+    data.reserve(reserve_);
+  data.add_data(std::move(datum));
 }
 
 template <typename T>
@@ -90,6 +108,12 @@ void PershotSnapshot<T>::combine(const PershotSnapshot<T> &other) {
 
 template <typename T>
 void PershotSnapshot<T>::combine(PershotSnapshot<T> &&other) noexcept {
+  // If empty we take ownership of the other snapshots storage
+  if (data_.empty()) {
+    data_ = std::move(other.data_);
+    other.clear();
+    return;
+  }
   for (auto &pair : other.data_) {
     data_[pair.first].combine(std::move(pair.second));
   }
@@ -97,6 +121,23 @@ void PershotSnapshot<T>::combine(PershotSnapshot<T> &&other) noexcept {
   other.clear();
 }
 
+template <typename T>
+json_t PershotSnapshot<T>::checkpoint() const {
+  json_t js = json_t::object();
+  for (const auto &pair : data_) {
+    js[pair.first] = pair.second.data();
+  }
+  return js;
+}
+
+template <typename T>
+void PershotSnapshot<T>::load_checkpoint(const json_t &js) {
+  clear();
+  for (auto it = js.begin(); it != js.end(); ++it) {
+    data_[it.key()].data() = it.value().get<std::vector<T>>();
+  }
+}
+
 //------------------------------------------------------------------------------
 // JSON serialization
 //------------------------------------------------------------------------------
@@ -15,9 +15,15 @@
 #ifndef _aer_framework_experiment_data_hpp_
 #define _aer_framework_experiment_data_hpp_
 
+#include <algorithm>
+#include <memory>
+
 #include "framework/json.hpp"
 #include "framework/results/data/average_snapshot.hpp"
+#include "framework/results/data/counts.hpp"
+#include "framework/results/data/packed_memory.hpp"
 #include "framework/results/data/pershot_snapshot.hpp"
+#include "framework/results/shot_sink.hpp"
 #include "framework/utils.hpp"
 
 namespace AER {
@@ -33,6 +39,8 @@ namespace AER {
  * - "snapshots" (bool): Return snapshots object in circuit data [Default: True]
  * - "memory" (bool): Return memory array in circuit data [Default: False]
  * - "register" (bool): Return register array in circuit data [Default: False]
+ * - "shot_sink_chunk" (int): Number of shots of per-shot data written to
+ *                            each record of a shot sink [Default: 1024]
  **************************************************************************/
 
 class ExperimentData {
@@ -41,15 +49,42 @@ class ExperimentData {
   // Measurement
   //----------------------------------------------------------------
 
-  // Add a single memory value to the counts map
-  void add_memory_count(const std::string &memory);
+  // Add a memory value of a number of shots to the counts map
+  void add_memory_count(const std::string &memory, uint_t count = 1);
+
+  // Add a num_memory bit memory value of a number of shots to the counts
+  // map. The memory value is given by its 64-bit words with the least
+  // significant word first.
+  void add_memory_count(const reg_t &memory, uint_t num_memory,
+                        uint_t count = 1);
 
-  // Add a single memory value to the memory vector
-  void add_pershot_memory(const std::string &memory);
+  // Add a single num_memory bit memory value to the per-shot memory. The
+  // memory value is given by its 64-bit words with the least significant
+  // word first.
+  void add_pershot_memory(const reg_t &memory, uint_t num_memory);
 
   // Add a single register value to the register vector
   void add_pershot_register(const std::string &reg);
 
+  // Mark the end of the per-shot data of a shot. If a shot sink is set the
+  // per-shot data is written to the sink once it holds a chunk of shots.
+  void end_shot();
+
+  //----------------------------------------------------------------
+  // Shot sink
+  //----------------------------------------------------------------
+
+  // Set a sink that per-shot data is streamed to instead of being kept.
+  // The records are tagged with the "_shot_sink_experiment" index and the
+  // shots are numbered from "_shot_sink_first_shot" of the config.
+  void set_shot_sink(const std::shared_ptr<ShotSink> &sink) {
+    shot_sink_ = sink;
+  }
+
+  // Write the per-shot data of all shots since the last record to the
+  // shot sink as a record, and clear it
+  void flush_shot_sink();
+
   //----------------------------------------------------------------
   // Pershot snapshots
   //----------------------------------------------------------------
@@ -118,9 +153,19 @@ class ExperimentData {
   // Empty engine of stored data
   void clear();
 
+  // Reserve storage of the pershot data containers for a number of shots
+  void reserve(uint_t shots);
+
   // Serialize engine data to JSON
   json_t json() const;
 
+  // Serialize all accumulated data to a lossless JSON that can
+  // be restored with `load_checkpoint` to resume an execution
+  json_t checkpoint() const;
+
+  // Replace the current data with the data from a checkpoint JSON
+  void load_checkpoint(const json_t &js);
+
   // Combine engines for accumulating data
   // Second engine should no longer be used after combining
   // as this function should use move semantics to minimize copying
@@ -141,10 +186,10 @@ class ExperimentData {
   //----------------------------------------------------------------
 
   // Histogram of memory counts over shots
-  std::map<std::string, uint_t> counts_;
+  Counts counts_;
 
-  // Memory state for each shot as hex string
-  std::vector<std::string> memory_;
+  // Memory state for each shot packed into bytes
+  PackedMemory memory_;
 
   // Register state for each shot as hex string
   std::vector<std::string> register_;
@@ -225,6 +270,42 @@ class ExperimentData {
   // Check if key name is reserved and if so throw an exception
   void check_reserved_key(const std::string &key);
 
+  // Number of shots to reserve storage for in pershot data containers
+  uint_t reserve_shots_ = 0;
+
+  //----------------------------------------------------------------
+  // Shot sink
+  //----------------------------------------------------------------
+
+  std::shared_ptr<ShotSink> shot_sink_;
+  uint_t shot_sink_chunk_ = 1024;
+  uint_t shot_sink_experiment_ = 0;
+
+  // Index of the first shot of the next record
+  uint_t shot_sink_first_shot_ = 0;
+
+  // Number of shots since the last record
+  uint_t shot_sink_shots_ = 0;
+
+  // Return the pershot snapshot container of the specified type, adding
+  // a container with reserved storage if it doesn't exist
+  template <typename T>
+  PershotSnapshot<T> &pershot_snapshot(
+      stringmap_t<PershotSnapshot<T>> &snapshots, const std::string &type);
+
+  // Combine a map of snapshot containers using move semantics
+  template <class snapshot_t>
+  static void combine_snapshots(stringmap_t<snapshot_t> &snapshots,
+                                stringmap_t<snapshot_t> &&other);
+
+  // Checkpoint helpers for maps of snapshot containers
+  template <class snapshot_t>
+  static json_t snapshots_checkpoint(const stringmap_t<snapshot_t> &snapshots);
+
+  template <class snapshot_t>
+  static void load_snapshots_checkpoint(stringmap_t<snapshot_t> &snapshots,
+                                        const json_t &js);
+
   //----------------------------------------------------------------
   // Metadata
   //----------------------------------------------------------------
@@ -239,6 +320,7 @@ class ExperimentData {
 
   bool return_counts_ = true;
   bool return_memory_ = false;
+  bool return_packed_memory_ = false;
   bool return_register_ = false;
   bool return_snapshots_ = true;
   bool return_additional_data_ = true;
@@ -251,28 +333,50 @@ class ExperimentData {
 void ExperimentData::set_config(const json_t &config) {
   JSON::get_value(return_counts_, "counts", config);
   JSON::get_value(return_memory_, "memory", config);
+  JSON::get_value(return_packed_memory_, "packed_memory", config);
   JSON::get_value(return_register_, "register", config);
   JSON::get_value(return_snapshots_, "snapshots", config);
+  if (JSON::get_value(shot_sink_chunk_, "shot_sink_chunk", config) &&
+      shot_sink_chunk_ == 0) {
+    throw std::invalid_argument(
+        "ExperimentData: shot_sink_chunk must be positive.");
+  }
+  JSON::get_value(shot_sink_experiment_, "_shot_sink_experiment", config);
+  JSON::get_value(shot_sink_first_shot_, "_shot_sink_first_shot", config);
 }
 
 //------------------------------------------------------------------
 // Classical data
 //------------------------------------------------------------------
 
-void ExperimentData::add_memory_count(const std::string &memory) {
+void ExperimentData::add_memory_count(const std::string &memory,
+                                      uint_t count) {
   // Memory bits value
   if (return_counts_ && !memory.empty()) {
-    counts_[memory] += 1;
+    counts_.add(memory, count);
   }
 }
 
-void ExperimentData::add_pershot_memory(const std::string &memory) {
+void ExperimentData::add_memory_count(const reg_t &memory, uint_t num_memory,
+                                      uint_t count) {
+  if (return_counts_) {
+    counts_.add(memory, num_memory, count);
+  }
+}
+
+void ExperimentData::add_pershot_memory(const reg_t &memory,
+                                        uint_t num_memory) {
   // Memory bits value
-  if (return_memory_ && !memory.empty()) {
-    memory_.push_back(memory);
+  if (return_memory_ && num_memory > 0) {
+    memory_.add(memory, num_memory);
   }
 }
 
+void ExperimentData::end_shot() {
+  if (shot_sink_ && ++shot_sink_shots_ >= shot_sink_chunk_)
+    flush_shot_sink();
+}
+
 void ExperimentData::add_pershot_register(const std::string &reg) {
   if (return_register_ && !reg.empty()) {
     register_.push_back(reg);
@@ -283,6 +387,17 @@ void ExperimentData::add_pershot_register(const std::string &reg) {
 // Pershot Snapshots
 //------------------------------------------------------------------
 
+template <typename T>
+PershotSnapshot<T> &ExperimentData::pershot_snapshot(
+    stringmap_t<PershotSnapshot<T>> &snapshots, const std::string &type) {
+  auto it = snapshots.find(type);
+  if (it == snapshots.end()) {
+    it = snapshots.emplace(type, PershotSnapshot<T>()).first;
+    it->second.reserve(reserve_shots_);
+  }
+  return it->second;
+}
+
 // Generic
 template <typename T>
 void ExperimentData::add_pershot_snapshot(const std::string &type,
@@ -300,7 +415,7 @@ void ExperimentData::add_pershot_snapshot(const std::string &type,
                                           const std::string &label,
                                           json_t &&datum) {
   if (return_snapshots_) {
-    pershot_json_snapshots_[type].add_data(label, std::move(datum));
+    pershot_snapshot(pershot_json_snapshots_, type).add_data(label, std::move(datum));
   }
 }
 
@@ -309,7 +424,7 @@ void ExperimentData::add_pershot_snapshot(const std::string &type,
                                           const std::string &label,
                                           const json_t &datum) {
   if (return_snapshots_) {
-    pershot_json_snapshots_[type].add_data(label, datum);
+    pershot_snapshot(pershot_json_snapshots_, type).add_data(label, datum);
   }
 }
 
@@ -318,7 +433,7 @@ void ExperimentData::add_pershot_snapshot(const std::string &type,
                                           const std::string &label,
                                           json_t &datum) {
   if (return_snapshots_) {
-    pershot_json_snapshots_[type].add_data(label, datum);
+    pershot_snapshot(pershot_json_snapshots_, type).add_data(label, datum);
   }
 }
 
@@ -328,7 +443,7 @@ void ExperimentData::add_pershot_snapshot(const std::string &type,
                                           const std::string &label,
                                           complex_t &&datum) {
   if (return_snapshots_) {
-    pershot_complex_snapshots_[type].add_data(label, std::move(datum));
+    pershot_snapshot(pershot_complex_snapshots_, type).add_data(label, std::move(datum));
   }
 }
 
@@ -337,7 +452,7 @@ void ExperimentData::add_pershot_snapshot(const std::string &type,
                                           const std::string &label,
                                           const complex_t &datum) {
   if (return_snapshots_) {
-    pershot_complex_snapshots_[type].add_data(label, datum);
+    pershot_snapshot(pershot_complex_snapshots_, type).add_data(label, datum);
   }
 }
 
@@ -346,7 +461,7 @@ void ExperimentData::add_pershot_snapshot(const std::string &type,
                                           const std::string &label,
                                           complex_t &datum) {
   if (return_snapshots_) {
-    pershot_complex_snapshots_[type].add_data(label, datum);
+    pershot_snapshot(pershot_complex_snapshots_, type).add_data(label, datum);
   }
 }
 
@@ -356,7 +471,7 @@ void ExperimentData::add_pershot_snapshot(const std::string &type,
                                           const std::string &label,
                                           cvector_t &&datum) {
   if (return_snapshots_) {
-    pershot_cvector_snapshots_[type].add_data(label, std::move(datum));
+    pershot_snapshot(pershot_cvector_snapshots_, type).add_data(label, std::move(datum));
   }
 }
 
@@ -365,7 +480,7 @@ void ExperimentData::add_pershot_snapshot(const std::string &type,
                                           const std::string &label,
                                           const cvector_t &datum) {
   if (return_snapshots_) {
-    pershot_cvector_snapshots_[type].add_data(label, datum);
+    pershot_snapshot(pershot_cvector_snapshots_, type).add_data(label, datum);
   }
 }
 
@@ -374,7 +489,7 @@ void ExperimentData::add_pershot_snapshot(const std::string &type,
                                           const std::string &label,
                                           cvector_t &datum) {
   if (return_snapshots_) {
-    pershot_cvector_snapshots_[type].add_data(label, datum);
+    pershot_snapshot(pershot_cvector_snapshots_, type).add_data(label, datum);
   }
 }
 
@@ -384,7 +499,7 @@ void ExperimentData::add_pershot_snapshot(const std::string &type,
                                           const std::string &label,
                                           cmatrix_t &&datum) {
   if (return_snapshots_) {
-    pershot_cmatrix_snapshots_[type].add_data(label, std::move(datum));
+    pershot_snapshot(pershot_cmatrix_snapshots_, type).add_data(label, std::move(datum));
   }
 }
 
@@ -393,7 +508,7 @@ void ExperimentData::add_pershot_snapshot(const std::string &type,
                                           const std::string &label,
                                           const cmatrix_t &datum) {
   if (return_snapshots_) {
-    pershot_cmatrix_snapshots_[type].add_data(label, datum);
+    pershot_snapshot(pershot_cmatrix_snapshots_, type).add_data(label, datum);
   }
 }
 
@@ -402,7 +517,7 @@ void ExperimentData::add_pershot_snapshot(const std::string &type,
                                           const std::string &label,
                                           cmatrix_t &datum) {
   if (return_snapshots_) {
-    pershot_cmatrix_snapshots_[type].add_data(label, datum);
+    pershot_snapshot(pershot_cmatrix_snapshots_, type).add_data(label, datum);
   }
 }
 
@@ -412,7 +527,7 @@ void ExperimentData::add_pershot_snapshot(
     const std::string &type, const std::string &label,
     std::map<std::string, complex_t> &&datum) {
   if (return_snapshots_) {
-    pershot_cmap_snapshots_[type].add_data(label, std::move(datum));
+    pershot_snapshot(pershot_cmap_snapshots_, type).add_data(label, std::move(datum));
   }
 }
 
@@ -421,7 +536,7 @@ void ExperimentData::add_pershot_snapshot(
     const std::string &type, const std::string &label,
     const std::map<std::string, complex_t> &datum) {
   if (return_snapshots_) {
-    pershot_cmap_snapshots_[type].add_data(label, datum);
+    pershot_snapshot(pershot_cmap_snapshots_, type).add_data(label, datum);
   }
 }
 
@@ -430,7 +545,7 @@ void ExperimentData::add_pershot_snapshot(
     const std::string &type, const std::string &label,
     std::map<std::string, complex_t> &datum) {
   if (return_snapshots_) {
-    pershot_cmap_snapshots_[type].add_data(label, datum);
+    pershot_snapshot(pershot_cmap_snapshots_, type).add_data(label, datum);
   }
 }
 
@@ -440,7 +555,7 @@ void ExperimentData::add_pershot_snapshot(
     const std::string &type, const std::string &label,
     std::map<std::string, double> &&datum) {
   if (return_snapshots_) {
-    pershot_rmap_snapshots_[type].add_data(label, std::move(datum));
+    pershot_snapshot(pershot_rmap_snapshots_, type).add_data(label, std::move(datum));
   }
 }
 
@@ -449,7 +564,7 @@ void ExperimentData::add_pershot_snapshot(
     const std::string &type, const std::string &label,
     const std::map<std::string, double> &datum) {
   if (return_snapshots_) {
-    pershot_rmap_snapshots_[type].add_data(label, datum);
+    pershot_snapshot(pershot_rmap_snapshots_, type).add_data(label, datum);
   }
 }
 
@@ -458,7 +573,7 @@ void ExperimentData::add_pershot_snapshot(
     const std::string &type, const std::string &label,
     std::map<std::string, double> &datum) {
   if (return_snapshots_) {
-    pershot_rmap_snapshots_[type].add_data(label, datum);
+    pershot_snapshot(pershot_rmap_snapshots_, type).add_data(label, datum);
   }
 }
 
@@ -848,17 +963,177 @@ void ExperimentData::clear() {
   metadata_.clear();
 }
 
+void ExperimentData::reserve(uint_t shots) {
+  // Per-shot data streamed to a sink is only stored for a chunk of shots
+  if (shot_sink_)
+    shots = std::min(shots, shot_sink_chunk_);
+  reserve_shots_ = shots;
+  if (return_memory_)
+    memory_.reserve(shots);
+  if (return_register_)
+    register_.reserve(shots);
+}
+
+//------------------------------------------------------------------
+// Shot sink
+//------------------------------------------------------------------
+
+void ExperimentData::flush_shot_sink() {
+  if (!shot_sink_)
+    return;
+  // Shots that only return counts may still have per-shot snapshots
+  if (shot_sink_shots_ == 0 && pershot_json_snapshots_.empty() &&
+      pershot_complex_snapshots_.empty() &&
+      pershot_cvector_snapshots_.empty() &&
+      pershot_cmatrix_snapshots_.empty() && pershot_cmap_snapshots_.empty() &&
+      pershot_rmap_snapshots_.empty())
+    return;
+  json_t record;
+  record["experiment"] = shot_sink_experiment_;
+  record["first_shot"] = shot_sink_first_shot_;
+  record["shots"] = shot_sink_shots_;
+  if (return_memory_ && memory_.empty() == false)
+    record["memory"] = memory_.hex();
+  if (return_register_ && register_.empty() == false)
+    record["register"] = register_;
+  if (return_snapshots_) {
+    json_t snapshots = json_t::object();
+    for (const auto &pair : pershot_json_snapshots_)
+      snapshots[pair.first] = pair.second;
+    for (const auto &pair : pershot_complex_snapshots_)
+      snapshots[pair.first] = pair.second;
+    for (const auto &pair : pershot_cvector_snapshots_)
+      snapshots[pair.first] = pair.second;
+    for (const auto &pair : pershot_cmatrix_snapshots_)
+      snapshots[pair.first] = pair.second;
+    for (const auto &pair : pershot_cmap_snapshots_)
+      snapshots[pair.first] = pair.second;
+    for (const auto &pair : pershot_rmap_snapshots_)
+      snapshots[pair.first] = pair.second;
+    if (!snapshots.empty())
+      record["snapshots"] = std::move(snapshots);
+  }
+  shot_sink_->push(record);
+
+  // Clear the per-shot data written to the record
+  memory_.clear();
+  register_.clear();
+  pershot_json_snapshots_.clear();
+  pershot_complex_snapshots_.clear();
+  pershot_cvector_snapshots_.clear();
+  pershot_cmatrix_snapshots_.clear();
+  pershot_cmap_snapshots_.clear();
+  pershot_rmap_snapshots_.clear();
+  shot_sink_first_shot_ += shot_sink_shots_;
+  shot_sink_shots_ = 0;
+}
+
+//------------------------------------------------------------------
+// Checkpointing
+//------------------------------------------------------------------
+
+template <class snapshot_t>
+json_t ExperimentData::snapshots_checkpoint(
+    const stringmap_t<snapshot_t> &snapshots) {
+  json_t js = json_t::object();
+  for (const auto &pair : snapshots) {
+    js[pair.first] = pair.second.checkpoint();
+  }
+  return js;
+}
+
+template <class snapshot_t>
+void ExperimentData::load_snapshots_checkpoint(
+    stringmap_t<snapshot_t> &snapshots, const json_t &js) {
+  snapshots.clear();
+  for (auto it = js.begin(); it != js.end(); ++it) {
+    snapshots[it.key()].load_checkpoint(it.value());
+  }
+}
+
+json_t ExperimentData::checkpoint() const {
+  json_t js;
+  js["counts"] = counts_.hex_counts();
+  js["memory"] = memory_.hex();
+  js["memory_bits"] = memory_.num_bits();
+  js["register"] = register_;
+
+  json_t &pershot = js["pershot_snapshots"];
+  pershot["json"] = snapshots_checkpoint(pershot_json_snapshots_);
+  pershot["complex"] = snapshots_checkpoint(pershot_complex_snapshots_);
+  pershot["cvector"] = snapshots_checkpoint(pershot_cvector_snapshots_);
+  pershot["cmatrix"] = snapshots_checkpoint(pershot_cmatrix_snapshots_);
+  pershot["cmap"] = snapshots_checkpoint(pershot_cmap_snapshots_);
+  pershot["rmap"] = snapshots_checkpoint(pershot_rmap_snapshots_);
+
+  json_t &average = js["average_snapshots"];
+  average["json"] = snapshots_checkpoint(average_json_snapshots_);
+  average["complex"] = snapshots_checkpoint(average_complex_snapshots_);
+  average["cvector"] = snapshots_checkpoint(average_cvector_snapshots_);
+  average["cmatrix"] = snapshots_checkpoint(average_cmatrix_snapshots_);
+  average["cmap"] = snapshots_checkpoint(average_cmap_snapshots_);
+  average["rmap"] = snapshots_checkpoint(average_rmap_snapshots_);
+
+  js["additional_json"] = additional_json_data_;
+  js["additional_cvector"] = additional_cvector_data_;
+  js["additional_cmatrix"] = additional_cmatrix_data_;
+  js["metadata"] = metadata_;
+  return js;
+}
+
+void ExperimentData::load_checkpoint(const json_t &js) {
+  clear();
+  for (const auto &pair :
+       js["counts"].get<std::map<std::string, uint_t>>()) {
+    counts_.add(pair.first, pair.second);
+  }
+  const uint_t memory_bits = js["memory_bits"].get<uint_t>();
+  for (const auto &hex : js["memory"].get<std::vector<std::string>>()) {
+    memory_.add(Utils::hex2words(hex), memory_bits);
+  }
+  register_ = js["register"].get<std::vector<std::string>>();
+
+  const json_t &pershot = js["pershot_snapshots"];
+  load_snapshots_checkpoint(pershot_json_snapshots_, pershot["json"]);
+  load_snapshots_checkpoint(pershot_complex_snapshots_, pershot["complex"]);
+  load_snapshots_checkpoint(pershot_cvector_snapshots_, pershot["cvector"]);
+  load_snapshots_checkpoint(pershot_cmatrix_snapshots_, pershot["cmatrix"]);
+  load_snapshots_checkpoint(pershot_cmap_snapshots_, pershot["cmap"]);
+  load_snapshots_checkpoint(pershot_rmap_snapshots_, pershot["rmap"]);
+
+  const json_t &average = js["average_snapshots"];
+  load_snapshots_checkpoint(average_json_snapshots_, average["json"]);
+  load_snapshots_checkpoint(average_complex_snapshots_, average["complex"]);
+  load_snapshots_checkpoint(average_cvector_snapshots_, average["cvector"]);
+  load_snapshots_checkpoint(average_cmatrix_snapshots_, average["cmatrix"]);
+  load_snapshots_checkpoint(average_cmap_snapshots_, average["cmap"]);
+  load_snapshots_checkpoint(average_rmap_snapshots_, average["rmap"]);
+
+  for (auto it = js["additional_json"].begin();
+       it != js["additional_json"].end(); ++it) {
+    additional_json_data_[it.key()] = it.value();
+  }
+  for (auto it = js["additional_cvector"].begin();
+       it != js["additional_cvector"].end(); ++it) {
+    additional_cvector_data_[it.key()] = it.value().get<cvector_t>();
+  }
+  for (auto it = js["additional_cmatrix"].begin();
+       it != js["additional_cmatrix"].end(); ++it) {
+    additional_cmatrix_data_[it.key()] = it.value().get<cmatrix_t>();
+  }
+  for (auto it = js["metadata"].begin(); it != js["metadata"].end(); ++it) {
+    metadata_[it.key()] = it.value();
+  }
+}
+
 ExperimentData &ExperimentData::combine(const ExperimentData &other) {
   // Combine measure
-  std::copy(other.memory_.begin(), other.memory_.end(),
-            std::back_inserter(memory_));
+  memory_.combine(other.memory_);
   std::copy(other.register_.begin(), other.register_.end(),
             std::back_inserter(register_));
 
   // Combine counts
-  for (auto pair : other.counts_) {
-    counts_[pair.first] += pair.second;
-  }
+  counts_.combine(other.counts_);
 
   // Combine pershot snapshots
   for (const auto &pair : other.pershot_json_snapshots_) {
@@ -925,57 +1200,65 @@ ExperimentData &ExperimentData::combine(const ExperimentData &other) {
   return *this;
 }
 
+template <class snapshot_t>
+void ExperimentData::combine_snapshots(stringmap_t<snapshot_t> &snapshots,
+                                       stringmap_t<snapshot_t> &&other) {
+  // If empty we take ownership of the other containers without
+  // touching the individual snapshots
+  if (snapshots.empty()) {
+    snapshots = std::move(other);
+  } else {
+    for (auto &pair : other) {
+      snapshots[pair.first].combine(std::move(pair.second));
+    }
+  }
+}
+
 ExperimentData &ExperimentData::combine(ExperimentData &&other) {
   // Combine measure
-  std::move(other.memory_.begin(), other.memory_.end(),
-            std::back_inserter(memory_));
-  std::move(other.register_.begin(), other.register_.end(),
-            std::back_inserter(register_));
+  memory_.combine(std::move(other.memory_));
+  if (register_.empty()) {
+    register_ = std::move(other.register_);
+  } else {
+    register_.reserve(register_.size() + other.register_.size());
+    std::move(other.register_.begin(), other.register_.end(),
+              std::back_inserter(register_));
+  }
 
   // Combine counts
-  for (auto pair : other.counts_) {
-    counts_[pair.first] += pair.second;
+  if (counts_.empty()) {
+    counts_ = std::move(other.counts_);
+  } else {
+    counts_.combine(other.counts_);
   }
 
   // Combine pershot snapshots
-  for (auto &pair : other.pershot_json_snapshots_) {
-    pershot_json_snapshots_[pair.first].combine(std::move(pair.second));
-  }
-  for (auto &pair : other.pershot_complex_snapshots_) {
-    pershot_complex_snapshots_[pair.first].combine(std::move(pair.second));
-  }
-  for (auto &pair : other.pershot_cvector_snapshots_) {
-    pershot_cvector_snapshots_[pair.first].combine(std::move(pair.second));
-  }
-  for (auto &pair : other.pershot_cmatrix_snapshots_) {
-    pershot_cmatrix_snapshots_[pair.first].combine(std::move(pair.second));
-  }
-  for (auto &pair : other.pershot_cmap_snapshots_) {
-    pershot_cmap_snapshots_[pair.first].combine(std::move(pair.second));
-  }
-  for (auto &pair : other.pershot_rmap_snapshots_) {
-    pershot_rmap_snapshots_[pair.first].combine(std::move(pair.second));
-  }
+  combine_snapshots(pershot_json_snapshots_,
+                    std::move(other.pershot_json_snapshots_));
+  combine_snapshots(pershot_complex_snapshots_,
+                    std::move(other.pershot_complex_snapshots_));
+  combine_snapshots(pershot_cvector_snapshots_,
+                    std::move(other.pershot_cvector_snapshots_));
+  combine_snapshots(pershot_cmatrix_snapshots_,
+                    std::move(other.pershot_cmatrix_snapshots_));
+  combine_snapshots(pershot_cmap_snapshots_,
+                    std::move(other.pershot_cmap_snapshots_));
+  combine_snapshots(pershot_rmap_snapshots_,
+                    std::move(other.pershot_rmap_snapshots_));
 
   // Combine average snapshots
-  for (auto &pair : other.average_json_snapshots_) {
-    average_json_snapshots_[pair.first].combine(std::move(pair.second));
-  }
-  for (auto &pair : other.average_complex_snapshots_) {
-    average_complex_snapshots_[pair.first].combine(std::move(pair.second));
-  }
-  for (auto &pair : other.average_cvector_snapshots_) {
-    average_cvector_snapshots_[pair.first].combine(std::move(pair.second));
-  }
-  for (auto &pair : other.average_cmatrix_snapshots_) {
-    average_cmatrix_snapshots_[pair.first].combine(std::move(pair.second));
-  }
-  for (auto &pair : other.average_cmap_snapshots_) {
-    average_cmap_snapshots_[pair.first].combine(std::move(pair.second));
-  }
-  for (auto &pair : other.average_rmap_snapshots_) {
-    average_rmap_snapshots_[pair.first].combine(std::move(pair.second));
-  }
+  combine_snapshots(average_json_snapshots_,
+                    std::move(other.average_json_snapshots_));
+  combine_snapshots(average_complex_snapshots_,
+                    std::move(other.average_complex_snapshots_));
+  combine_snapshots(average_cvector_snapshots_,
+                    std::move(other.average_cvector_snapshots_));
+  combine_snapshots(average_cmatrix_snapshots_,
+                    std::move(other.average_cmatrix_snapshots_));
+  combine_snapshots(average_cmap_snapshots_,
+                    std::move(other.average_cmap_snapshots_));
+  combine_snapshots(average_rmap_snapshots_,
+                    std::move(other.average_rmap_snapshots_));
 
   // Combine metadata
   for (auto &pair : other.metadata_) {
@@ -1014,8 +1297,8 @@ json_t ExperimentData::json() const {
   json_t tmp;
 
   // Measure data
-  if (return_counts_ && counts_.empty() == false) tmp["counts"] = counts_;
-  if (return_memory_ && memory_.empty() == false) tmp["memory"] = memory_;
+  if (return_counts_ && counts_.empty() == false) tmp["counts"] = counts_.hex_counts();
+  if (return_memory_ && memory_.empty() == false) tmp["memory"] = memory_.hex();
   if (return_register_ && register_.empty() == false)
     tmp["register"] = register_;
 
@@ -0,0 +1,205 @@
+/**
+ * This code is part of Qiskit.
+ *
+ * (C) Copyright IBM 2018, 2019, 2020.
+ *
+ * This code is licensed under the Apache License, Version 2.0. You may
+ * obtain a copy of this license in the LICENSE.txt file in the root directory
+ * of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Any modifications or derivative works of this code must retain this
+ * copyright notice, and modified files need to carry a notice indicating
+ * that they have been altered from the originals.
+ */
+
+#ifndef _aer_framework_results_shot_sink_hpp_
+#define _aer_framework_results_shot_sink_hpp_
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "framework/json.hpp"
+#include "framework/types.hpp"
+
+namespace AER {
+
+//============================================================================
+// Result sink for streaming per-shot data to a file
+//============================================================================
+
+/**************************************************************************
+ * A shot sink appends records of per-shot data to a local file so that
+ * they don't need to be held in memory until the end of an execution.
+ *
+ * Records are serialized by the threads that push them and queued for a
+ * writer thread which appends them to the file. The queue holds at most
+ * `max_queued` records, so threads pushing records wait for the writer if
+ * the file can't be written as fast as records are produced.
+ *
+ * File formats:
+ *  - "ndjson": each record is a line of JSON text
+ *  - "binary": the 8 byte magic string "AERSHOT1" followed by each record
+ *    as a uint64 size in bytes and the CBOR encoding of the record. Sizes
+ *    are stored in the native byte order.
+ **************************************************************************/
+
+class ShotSink {
+public:
+  // Open the sink file `path` for writing records in the given format,
+  // replacing any existing file, and start the writer thread
+  ShotSink(const std::string &path, const std::string &format,
+           size_t max_queued = 64);
+
+  // Close the sink, ignoring any write error
+  ~ShotSink();
+
+  ShotSink(const ShotSink &) = delete;
+  ShotSink &operator=(const ShotSink &) = delete;
+
+  // Serialize a record and queue it for writing. An exception is raised
+  // if the sink is closed or the writer failed.
+  void push(const json_t &record);
+
+  // Write all queued records, stop the writer thread and close the file.
+  // An exception is raised if writing any record failed.
+  void close();
+
+  // Return the sink file path
+  const std::string &path() const {return path_;}
+
+  // Return the sink file format
+  const std::string &format() const {return format_;}
+
+  // Return the number of records pushed to the sink
+  uint_t records() const {return records_;}
+
+private:
+  static const std::string magic_;
+
+  // Writer thread loop
+  void write_records();
+
+  std::string path_;
+  std::string format_;
+  std::ofstream file_;
+
+  // Queue of serialized records waiting to be written
+  std::deque<std::string> queue_;
+  size_t max_queued_;
+  std::mutex mutex_;
+  std::condition_variable queue_ready_;
+  std::condition_variable queue_space_;
+
+  bool closing_ = false;
+  bool failed_ = false;
+  uint_t records_ = 0;
+  std::thread writer_;
+};
+
+//============================================================================
+// Implementations
+//============================================================================
+
+const std::string ShotSink::magic_ = "AERSHOT1";
+
+ShotSink::ShotSink(const std::string &path, const std::string &format,
+                   size_t max_queued)
+    : path_(path), format_(format), max_queued_(std::max<size_t>(max_queued, 1)) {
+  if (format_ != "ndjson" && format_ != "binary") {
+    throw std::invalid_argument("ShotSink: invalid format \"" + format_ +
+                                "\" (must be \"ndjson\" or \"binary\").");
+  }
+  file_.open(path_, std::ios::binary | std::ios::trunc);
+  if (!file_) {
+    throw std::runtime_error("ShotSink: unable to open file \"" + path_ +
+                             "\" for writing.");
+  }
+  if (format_ == "binary")
+    file_.write(magic_.data(), magic_.size());
+  writer_ = std::thread(&ShotSink::write_records, this);
+}
+
+ShotSink::~ShotSink() {
+  try {
+    close();
+  } catch (std::exception &) {
+  }
+}
+
+void ShotSink::push(const json_t &record) {
+  std::string bytes;
+  if (format_ == "binary") {
+    const std::string cbor = JSON::serialize(record, "cbor");
+    const uint64_t size = cbor.size();
+    bytes.reserve(sizeof(size) + cbor.size());
+    bytes.append(reinterpret_cast<const char *>(&size), sizeof(size));
+    bytes.append(cbor);
+  } else {
+    bytes = record.dump();
+    bytes.push_back('\n');
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  queue_space_.wait(lock, [this]() {
+    return queue_.size() < max_queued_ || closing_ || failed_;
+  });
+  if (closing_ || failed_) {
+    throw std::runtime_error("ShotSink: unable to write to file \"" + path_ +
+                             "\".");
+  }
+  queue_.push_back(std::move(bytes));
+  records_++;
+  queue_ready_.notify_one();
+}
+
+void ShotSink::close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closing_ && !writer_.joinable())
+      return;
+    closing_ = true;
+  }
+  queue_ready_.notify_all();
+  queue_space_.notify_all();
+  if (writer_.joinable())
+    writer_.join();
+  file_.close();
+  if (failed_ || file_.fail()) {
+    throw std::runtime_error("ShotSink: failed to write file \"" + path_ +
+                             "\".");
+  }
+}
+
+void ShotSink::write_records() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    queue_ready_.wait(lock, [this]() {return !queue_.empty() || closing_;});
+    if (queue_.empty())
+      return;
+    std::string bytes = std::move(queue_.front());
+    queue_.pop_front();
+    queue_space_.notify_one();
+    // Write without holding the lock so that records can be queued
+    lock.unlock();
+    file_.write(bytes.data(), bytes.size());
+    const bool ok = file_.good();
+    lock.lock();
+    if (!ok) {
+      failed_ = true;
+      queue_.clear();
+      queue_space_.notify_all();
+      return;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+} // end namespace AER
+//------------------------------------------------------------------------------
+#endif
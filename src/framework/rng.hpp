@@ -15,13 +15,60 @@
 #ifndef _aer_framework_rng_hpp_
 #define _aer_framework_rng_hpp_
 
+#include <algorithm>
 #include <cstdint>
 #include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include "framework/types.hpp"
 
 namespace AER {
 
+/***************************************************************************/ /**
+  *
+  * AliasTable Class
+  *
+  * Walker alias table for sampling from a fixed discrete distribution in
+  * constant time. The table is constructed once in O(n) using Vose's method
+  * and can then be sampled repeatedly with a single uniform random number.
+  *
+  ******************************************************************************/
+
+class AliasTable {
+public:
+  AliasTable() = default;
+
+  /**
+   * Construct the alias table for a vector of probabilities for [0,..,n-1].
+   * If this vector is not normalized it will be scaled.
+   * @param probs the vector of probabilities
+   */
+  explicit AliasTable(const std::vector<double> &probs);
+
+  /**
+   * Return the outcome for a uniformly distributed real in [0,1).
+   * If the table is empty this returns 0.
+   * @param u the uniform random number
+   * @return the sampled integer
+   */
+  uint_t sample(double u) const;
+
+  // Return the number of outcomes of the distribution
+  size_t size() const { return prob_.size(); };
+
+  // Return true if the table has no outcomes
+  bool empty() const { return prob_.empty(); };
+
+private:
+  // Probability of keeping each outcome rather than its alias
+  std::vector<double> prob_;
+  // Alias outcome for each outcome
+  std::vector<uint_t> alias_;
+};
+
 /***************************************************************************/ /**
   *
   * RngEngine Class
@@ -79,6 +126,26 @@ public:
    */
   uint_t rand_int(const std::vector<double> &probs);
 
+  /**
+   * Generate a pseudo random integer from a discrete distribution
+   * stored as a precomputed alias table. Unlike sampling from a vector
+   * of probabilities this does not construct a new distribution.
+   * @param table the alias table of the distribution
+   * @return the generated integer
+   */
+  uint_t rand_int(const AliasTable &table);
+
+  /**
+   * Generate the number of outcomes of n independent trials of a discrete
+   * distribution for [0,..,m-1] where m is the length of the vector of
+   * probabilities. If this vector is not normalized it will be scaled.
+   * @param n the number of trials
+   * @param probs the vector of probabilities
+   * @return the vector of the number of trials with each outcome
+   */
+  std::vector<uint_t> rand_multinomial(uint_t n,
+                                       const std::vector<double> &probs);
+
   /**
    * Default constructor initialize RNG engine with a random seed
    */
@@ -97,6 +164,20 @@ public:
   // Set a fixed seed for the RNG engine
   void set_seed(uint_t seed) { rng.seed(seed); };
 
+  /**
+   * Return the full internal state of the mt19937 engine as a string
+   * so that the random sequence can be resumed with `set_state`.
+   * @return the serialized engine state
+   */
+  std::string state() const;
+
+  /**
+   * Restore the internal state of the mt19937 engine from a string
+   * returned by `state`.
+   * @param state the serialized engine state
+   */
+  void set_state(const std::string &state);
+
 private:
   std::mt19937 rng; // Mersenne twister rng engine
 };
@@ -107,6 +188,57 @@ private:
  *
  ******************************************************************************/
 
+AliasTable::AliasTable(const std::vector<double> &probs) {
+  const size_t n = probs.size();
+  double total = 0.;
+  for (const auto &p : probs) {
+    if (p < 0) {
+      throw std::invalid_argument("AliasTable: negative probability.");
+    }
+    total += p;
+  }
+  if (n == 0 || !(total > 0)) {
+    throw std::invalid_argument("AliasTable: probabilities sum to zero.");
+  }
+  prob_.assign(n, 1.);
+  alias_.resize(n);
+  // Scale probabilities so the average is 1 and split them into
+  // outcomes with less and more than the average
+  std::vector<double> scaled(n);
+  std::vector<uint_t> small, large;
+  for (size_t j = 0; j < n; j++) {
+    alias_[j] = j;
+    scaled[j] = probs[j] * n / total;
+    if (scaled[j] < 1.)
+      small.push_back(j);
+    else
+      large.push_back(j);
+  }
+  // Fill the remainder of each small outcome with a large outcome
+  while (!small.empty() && !large.empty()) {
+    const uint_t l = small.back();
+    small.pop_back();
+    const uint_t g = large.back();
+    prob_[l] = scaled[l];
+    alias_[l] = g;
+    scaled[g] -= 1. - scaled[l];
+    if (scaled[g] < 1.) {
+      large.pop_back();
+      small.push_back(g);
+    }
+  }
+  // Any remaining outcomes are only left over from rounding errors
+  // and are kept with probability 1
+}
+
+uint_t AliasTable::sample(double u) const {
+  if (prob_.empty())
+    return 0;
+  const double x = u * prob_.size();
+  const uint_t j = std::min<uint_t>(static_cast<uint_t>(x), prob_.size() - 1);
+  return (x - j < prob_[j]) ? j : alias_[j];
+}
+
 double RngEngine::rand(double a, double b) {
   double p = std::uniform_real_distribution<double>(a, b)(rng);
   return p;
@@ -129,6 +261,44 @@ uint_t RngEngine::rand_int(const std::vector<double> &probs) {
   return n;
 }
 
+uint_t RngEngine::rand_int(const AliasTable &table) {
+  return table.sample(rand());
+}
+
+// multinomial distribution sampled as a sequence of binomial distributions
+std::vector<uint_t> RngEngine::rand_multinomial(uint_t n,
+                                                const std::vector<double> &probs) {
+  std::vector<uint_t> counts(probs.size(), 0);
+  double remaining = 0.;
+  for (const auto &p : probs)
+    remaining += p;
+  for (size_t k = 0; k < probs.size() && n > 0; ++k) {
+    if (k + 1 == probs.size() || !(remaining > probs[k])) {
+      counts[k] = n;
+      break;
+    }
+    const double p = std::max(0., probs[k] / remaining);
+    counts[k] = std::binomial_distribution<uint_t>(n, p)(rng);
+    n -= counts[k];
+    remaining -= probs[k];
+  }
+  return counts;
+}
+
+std::string RngEngine::state() const {
+  std::ostringstream ss;
+  ss << rng;
+  return ss.str();
+}
+
+void RngEngine::set_state(const std::string &state) {
+  std::istringstream ss(state);
+  ss >> rng;
+  if (ss.fail()) {
+    throw std::invalid_argument("RngEngine: invalid engine state.");
+  }
+}
+
 //------------------------------------------------------------------------------
 } // End namespace QISKIT
 #endif
@@ -406,6 +406,14 @@ std::string bin2hex(const std::string bin, bool prefix = true);
 // if prefix is true "0b" will prepend the output string
 std::string hex2bin(const std::string bs, bool prefix = true);
 
+// Convert hex-strings to 64-bit words with the least significant word first
+reg_t hex2words(std::string str);
+
+// Convert 64-bit words with the least significant word first to hex-strings.
+// The output is the same as bin2hex of the bit-string of the words.
+// if prefix is true "0x" will prepend the output string
+std::string words2hex(const reg_t &words, bool prefix = true);
+
 // Convert 64-bit unsigned integers to dit-string (dit base = 2 to 10)
 std::string int2string(uint_t n, uint_t base = 2);
 std::string int2string(uint_t n, uint_t base, uint_t length);
@@ -1507,6 +1515,52 @@ std::string bin2hex(std::string str, bool prefix) {
 }
 
 
+reg_t hex2words(std::string str) {
+  // If string starts with 0x prefix
+  if (str.size() > 1 && (str.substr(0, 2) == "0x" || str.substr(0, 2) == "0X")) {
+    str.erase(0, 2);
+  }
+  // Each 64-bit word is 16 hex digits
+  const size_t block = 16;
+  reg_t words;
+  words.reserve((str.size() + block - 1) / block);
+  size_t end = str.size();
+  while (end > 0) {
+    const size_t start = (end > block) ? end - block : 0;
+    words.push_back(std::stoull(str.substr(start, end - start), nullptr, 16));
+    end = start;
+  }
+  return words;
+}
+
+
+std::string words2hex(const reg_t &words, bool prefix) {
+  // empty case
+  if (words.empty())
+    return std::string();
+
+  static const char digits[] = "0123456789abcdef";
+  std::string hex = (prefix) ? "0x" : "";
+  hex.reserve(hex.size() + 16 * words.size());
+
+  // Most significant word without leading zeros
+  uint_t word = words.back();
+  int shift = 60;
+  while (shift > 0 && ((word >> shift) & 0xF) == 0)
+    shift -= 4;
+  for (; shift >= 0; shift -= 4)
+    hex.push_back(digits[(word >> shift) & 0xF]);
+
+  // Remaining words padded to 16 digits
+  for (size_t j = words.size() - 1; j-- > 0;) {
+    word = words[j];
+    for (shift = 60; shift >= 0; shift -= 4)
+      hex.push_back(digits[(word >> shift) & 0xF]);
+  }
+  return hex;
+}
+
+
 uint_t reg2int(const reg_t &reg, uint_t base) {
   uint_t ret = 0;
   if (base == 2) {
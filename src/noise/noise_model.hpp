@@ -18,6 +18,10 @@
 #define _USE_MATH_DEFINES
 #include <math.h>
 
+#include <algorithm>
+#include <sstream>
+#include <unordered_map>
+
 #include "framework/operations.hpp"
 #include "framework/types.hpp"
 #include "framework/rng.hpp"
@@ -47,6 +51,50 @@ public:
   NoiseModel() = default;
   NoiseModel(const json_t &js) {load_from_json(js);}
 
+  //-----------------------------------------------------------------------
+  // Compiled errors
+  //-----------------------------------------------------------------------
+
+  // Location of an error of the noise model in a circuit
+  struct ErrorLocation {
+    size_t position; // position of the error in the list of errors
+    reg_t qubits;    // qubits of a quantum error, or memory of a readout error
+    reg_t registers; // registers of a readout error
+  };
+
+  // The errors of the noise model that apply to a single circuit operation.
+  // These are resolved once from the error tables so that sampling noise
+  // for each shot doesn't require any table lookups.
+  struct OpErrors {
+    // True if the op is replaced by its X90 decomposition, in which case
+    // the quantum errors are those of the X90 pulses
+    bool waltz = false;
+    // Quantum errors in the order they are sampled
+    std::vector<ErrorLocation> quantum_errors;
+    // Readout errors of a measure op in the order they are sampled
+    std::vector<ErrorLocation> readout_errors;
+
+    // Return true if no noise is sampled for the op
+    bool empty() const {
+      return !waltz && quantum_errors.empty() && readout_errors.empty();
+    }
+  };
+
+  // The compiled errors for each operation of a circuit
+  using CircuitErrors = std::vector<OpErrors>;
+
+  // Resolve the errors for each operation of a circuit. The result is only
+  // valid for the circuit and the current noise model, and must be
+  // recompiled if either is modified.
+  CircuitErrors compile_errors(const Circuit &circ) const;
+
+  // Resolve the errors for a single circuit operation
+  OpErrors compile_errors(const Operations::Op &op) const;
+
+  //-----------------------------------------------------------------------
+  // Sampling noise
+  //-----------------------------------------------------------------------
+
   // Sample a noisy implementation of a full circuit
   // An RngEngine is passed in as a reference so that sampling
   // can be done in a thread-safe manner.
@@ -56,6 +104,117 @@ public:
   Circuit sample_noise(const Circuit &circ,
                        RngEngine &rng) const;
 
+  // Sample a noisy implementation of a full circuit using the errors
+  // compiled for the circuit by `compile_errors`
+  Circuit sample_noise(const Circuit &circ,
+                       const CircuitErrors &errors,
+                       RngEngine &rng) const;
+
+  // Sample a noisy implementation of a single circuit operation and
+  // append it to noisy_ops. The noise_active flag is updated by noise_switch
+  // operations and no noise is sampled while it is false.
+  // Returns true if the appended ops differ from the input op.
+  bool sample_noise(const Operations::Op &op,
+                    bool &noise_active,
+                    NoiseOps &noisy_ops,
+                    RngEngine &rng) const;
+
+  // Sample a noisy implementation of a single circuit operation using the
+  // errors compiled for the operation by `compile_errors`
+  bool sample_noise(const Operations::Op &op,
+                    const OpErrors &errors,
+                    bool &noise_active,
+                    NoiseOps &noisy_ops,
+                    RngEngine &rng) const;
+
+  // Sample the errors of a single circuit operation without copying it,
+  // for executing a noisy circuit by streaming the operations of the
+  // circuit interleaved with the sampled error ops. The sampled ops to
+  // apply before and after the operation are appended to noise_before and
+  // noise_after. Returns false if the operation itself must not be
+  // applied, which is the case for noise_switch operations, operations
+  // while noise is switched off, and waltz gates whose noisy X90 pulse
+  // implementation is appended to noise_before.
+  // Only the standard method is supported.
+  bool sample_noise(const Operations::Op &op,
+                    const OpErrors &errors,
+                    bool &noise_active,
+                    NoiseOps &noise_before,
+                    NoiseOps &noise_after,
+                    RngEngine &rng) const;
+
+  //-----------------------------------------------------------------------
+  // Sparse sampling of error events
+  //-----------------------------------------------------------------------
+
+  // A non-identity error sampled at an error location of a circuit.
+  // The error locations of a circuit are the quantum errors of its
+  // compiled errors numbered in circuit order.
+  struct ErrorEvent {
+    uint_t location; // position of the error location
+    uint_t circuit;  // position of the sampled QuantumError circuit
+
+    bool operator<(const ErrorEvent &other) const {
+      return (location != other.location) ? location < other.location
+                                          : circuit < other.circuit;
+    }
+  };
+
+  // The error events of a single shot in circuit order
+  using ErrorPattern = std::vector<ErrorEvent>;
+
+  // Return true if the error events of a circuit can be sampled before
+  // executing it. This requires the standard sampling method, and no
+  // noise switch or X90 waltz operations.
+  bool sparse_sampling_supported(const Circuit &circ,
+                                 const CircuitErrors &errors) const;
+
+  // Return the expected number of non-identity error events in a shot
+  double expected_error_events(const CircuitErrors &errors) const;
+
+  // Sample the error events of a number of shots and return the number of
+  // shots with each pattern of error events. Shots without any error
+  // events have the empty pattern.
+  std::map<ErrorPattern, uint_t> sample_error_patterns(const CircuitErrors &errors,
+                                                       uint_t shots,
+                                                       RngEngine &rng) const;
+
+  // Return the noisy implementation of a circuit for a pattern of error
+  // events. The RngEngine is only used for adding readout errors.
+  Circuit error_pattern_circuit(const Circuit &circ,
+                                const CircuitErrors &errors,
+                                const ErrorPattern &pattern,
+                                RngEngine &rng) const;
+
+  // Return the noisy implementation of a single op of a circuit for the
+  // error events of a pattern. The error locations of the op are numbered
+  // from location, and event is advanced past the events at these
+  // locations. The RngEngine is only used for adding readout errors.
+  NoiseOps error_pattern_ops(const Operations::Op &op,
+                             const OpErrors &errors,
+                             uint_t location,
+                             ErrorPattern::const_iterator &event,
+                             const ErrorPattern::const_iterator &end,
+                             RngEngine &rng) const;
+
+  //-----------------------------------------------------------------------
+  // Pauli frame sampling
+  //-----------------------------------------------------------------------
+
+  // Return true if every quantum error of the compiled errors of a circuit
+  // only samples circuits of Pauli gates. Readout errors are allowed.
+  bool pauli_errors(const CircuitErrors &errors) const;
+
+  // Return the quantum error of a compiled error location
+  inline const QuantumError& quantum_error(const ErrorLocation &error) const {
+    return quantum_errors_[error.position];
+  }
+
+  // Append the readout error ops of compiled errors to noise_ops
+  void sample_readout_noise(const OpErrors &errors,
+                            NoiseOps &noise_ops,
+                            RngEngine &rng) const;
+
   // Set sample mode to superoperator
   // This will cause all QuantumErrors stored in the noise model
   // to calculate their superoperator representations and raise
@@ -98,6 +257,14 @@ public:
   // Load a noise model from JSON
   void load_from_json(const json_t &js);
 
+  // Add an error from a JSON error object of a noise model
+  void add_error_from_json(const json_t &js);
+
+  // Add an error from a JSON error object of a noise model, using a quantum
+  // error already loaded from its "instructions" and "probabilities" for a
+  // "qerror" object.
+  void add_error_from_json(const json_t &js, const QuantumError &error);
+
   // Add a QuantumError to the noise model
   void add_quantum_error(const QuantumError &error,
                          const stringset_t &op_labels,
@@ -139,35 +306,65 @@ public:
 private:
 
   // Sample noise for the current operation.
+  // If sampled is not null it is set to true if any errors were sampled.
   NoiseOps sample_noise(const Operations::Op &op,
-                        RngEngine &rng) const;
+                        const OpErrors &errors,
+                        RngEngine &rng,
+                        bool *sampled = nullptr) const;
 
-  // Sample noise for the current operation
-  void sample_readout_noise(const Operations::Op &op,
-                            NoiseOps &noise_after,
-                            RngEngine &rng)  const;
+  // Resolve the errors for the current operation from the error tables
+  void compile_readout_errors(const Operations::Op &op,
+                              OpErrors &errors) const;
 
-  void sample_local_quantum_noise(const Operations::Op &op,
-                                  NoiseOps &noise_before,
-                                  NoiseOps &noise_after,
-                                  RngEngine &rng)  const;
+  void compile_local_quantum_errors(const Operations::Op &op,
+                                    OpErrors &errors) const;
 
-  void sample_nonlocal_quantum_noise(const Operations::Op &op,
-                                     NoiseOps &noise_ops,
-                                     NoiseOps &noise_after,
-                                     RngEngine &rng) const;
+  void compile_nonlocal_quantum_errors(const Operations::Op &op,
+                                       OpErrors &errors) const;
 
   // Sample noise for the current operation
   NoiseOps sample_noise_helper(const Operations::Op &op,
-                               RngEngine &rng) const;
+                               const OpErrors &errors,
+                               RngEngine &rng,
+                               bool *sampled = nullptr) const;
+
+  // Combine an operation with the errors before and after it, fusing
+  // them into a single unitary or superop if possible
+  NoiseOps combine_noise(const Operations::Op &op,
+                         NoiseOps &noise_before,
+                         const NoiseOps &noise_after) const;
+
+  // Append the superop method implementation of an operation to noisy_ops
+  // as a single superop of the operation and its quantum errors, followed
+  // by its readout errors. The fused superops of gates are cached by gate
+  // name, params and qubits. Returns false if the operation and its errors
+  // cannot be fused, in which case nothing is appended.
+  bool sample_superop_noise(const Operations::Op &op,
+                            const OpErrors &errors,
+                            std::unordered_map<std::string, cmatrix_t> &cache,
+                            NoiseOps &noisy_ops,
+                            RngEngine &rng) const;
+
+  // Merge each single-qubit superop into the previous or next superop
+  // acting on the same qubit, if no other operation acts on the qubit
+  // between them
+  void merge_superops(NoiseOps &ops) const;
+
+  // Return the superoperator matrix of a superoperator on qubits extended
+  // to a superoperator on dst_qubits, which must contain the qubits
+  static cmatrix_t expand_superop(const cmatrix_t &mat,
+                                  const reg_t &qubits,
+                                  const reg_t &dst_qubits);
 
   // Sample a noisy implementation of a two-X90 pulse u3 gate
   NoiseOps sample_noise_x90_u3(uint_t qubit, complex_t theta,
                                complex_t phi, complex_t lamba,
+                               const OpErrors &errors,
                                RngEngine &rng) const;
   
   // Sample a noisy implementation of a single-X90 pulse u2 gate
   NoiseOps sample_noise_x90_u2(uint_t qubit, complex_t phi, complex_t lambda,
+                               const OpErrors &errors,
                                RngEngine &rng) const;
 
   // Add a local quantum error to the noise model for specific qubits
@@ -244,13 +441,16 @@ private:
 //=========================================================================
 
 NoiseModel::NoiseOps NoiseModel::sample_noise(const Operations::Op &op,
-                                              RngEngine &rng) const {
-  // Look to see if gate is a waltz gate for this error model
-  auto it = x90_gates_.find(op.name);
-  if (it == x90_gates_.end()) {
+                                              const OpErrors &errors,
+                                              RngEngine &rng,
+                                              bool *sampled) const {
+  if (!errors.waltz) {
     // Non-X90 based gate, run according to base model
-    return sample_noise_helper(op, rng);
+    return sample_noise_helper(op, errors, rng, sampled);
   }
+  // Waltz gates are always replaced by their decomposition
+  if (sampled != nullptr)
+    *sampled = true;
   // Decompose ops in terms of their waltz implementation
   auto gate = waltz_gate_table_.find(op.name);
   if (gate != waltz_gate_table_.end()) {
@@ -258,17 +458,18 @@ NoiseModel::NoiseOps NoiseModel::sample_noise(const Operations::Op &op,
       case WaltzGate::u3:
         return sample_noise_x90_u3(op.qubits[0],
                                    op.params[0], op.params[1], op.params[2],
-                                   rng);
+                                   errors, rng);
       case WaltzGate::u2:
         return sample_noise_x90_u2(op.qubits[0],
                                    op.params[0], op.params[1],
-                                   rng);
+                                   errors, rng);
       case WaltzGate::x:
-        return sample_noise_x90_u3(op.qubits[0], M_PI, 0., M_PI, rng);
+        return sample_noise_x90_u3(op.qubits[0], M_PI, 0., M_PI, errors, rng);
       case WaltzGate::y:
-        return sample_noise_x90_u3(op.qubits[0],  M_PI, 0.5 * M_PI, 0.5 * M_PI, rng);
+        return sample_noise_x90_u3(op.qubits[0],  M_PI, 0.5 * M_PI, 0.5 * M_PI,
+                                   errors, rng);
       case WaltzGate::h:
-        return sample_noise_x90_u2(op.qubits[0], 0., M_PI, rng);
+        return sample_noise_x90_u2(op.qubits[0], 0., M_PI, errors, rng);
       default:
         // The rest of the Waltz operations are noise free (u1 only)
         return {op};
@@ -282,46 +483,343 @@ NoiseModel::NoiseOps NoiseModel::sample_noise(const Operations::Op &op,
 
 Circuit NoiseModel::sample_noise(const Circuit &circ,
                                  RngEngine &rng) const {
+  return sample_noise(circ, compile_errors(circ), rng);
+}
+
+
+Circuit NoiseModel::sample_noise(const Circuit &circ,
+                                 const CircuitErrors &errors,
+                                 RngEngine &rng) const {
+    if (errors.size() != circ.ops.size()) {
+      throw std::invalid_argument(
+        "NoiseModel: compiled errors do not match the circuit.");
+    }
     bool noise_active = true; // set noise active to on-state
     Circuit noisy_circ = circ; // copy input circuit
     noisy_circ.measure_sampling_flag = false; // disable measurement opt flag
     noisy_circ.ops.clear(); // delete ops
     noisy_circ.ops.reserve(2 * circ.ops.size()); // just to be safe?
+    // Fused superops of the gates of the circuit for the superop method
+    std::unordered_map<std::string, cmatrix_t> superop_cache;
     // Sample a noisy realization of the circuit
-    for (const auto &op: circ.ops) {
-      switch (op.type) {
-        // Operations that cannot have noise
-        case Operations::OpType::barrier:
-          noisy_circ.ops.push_back(op);
-          break;
-        case Operations::OpType::snapshot:
-          noisy_circ.ops.push_back(op);
-          break;
-        case Operations::OpType::kraus:
-          noisy_circ.ops.push_back(op);
-          break;
-        case Operations::OpType::superop:
-          noisy_circ.ops.push_back(op);
-          break;
-        case Operations::OpType::roerror:
-          noisy_circ.ops.push_back(op);
-          break;
-        case Operations::OpType::bfunc:
-          noisy_circ.ops.push_back(op);
-          break;
-        // Switch noise on or off during current circuit sample
-        case Operations::OpType::noise_switch:
-          noise_active = static_cast<int>(std::real(op.params[0]));
-          break;
-        default:
-          if (noise_active) {
-            NoiseOps noisy_op = sample_noise(op, rng);
-            noisy_circ.ops.insert(noisy_circ.ops.end(), noisy_op.begin(), noisy_op.end());
-          }
+    for (size_t pos = 0; pos < circ.ops.size(); ++pos) {
+      if (method_ == Method::superop && noise_active &&
+          sample_superop_noise(circ.ops[pos], errors[pos], superop_cache,
+                               noisy_circ.ops, rng))
+        continue;
+      sample_noise(circ.ops[pos], errors[pos], noise_active, noisy_circ.ops, rng);
+    }
+    if (method_ == Method::superop)
+      merge_superops(noisy_circ.ops);
+    return noisy_circ;
+}
+
+
+bool NoiseModel::sample_noise(const Operations::Op &op,
+                              bool &noise_active,
+                              NoiseOps &noisy_ops,
+                              RngEngine &rng) const {
+  return sample_noise(op, compile_errors(op), noise_active, noisy_ops, rng);
+}
+
+
+bool NoiseModel::sample_noise(const Operations::Op &op,
+                              const OpErrors &errors,
+                              bool &noise_active,
+                              NoiseOps &noisy_ops,
+                              RngEngine &rng) const {
+  switch (op.type) {
+    // Operations that cannot have noise
+    case Operations::OpType::barrier:
+    case Operations::OpType::snapshot:
+    case Operations::OpType::kraus:
+    case Operations::OpType::superop:
+    case Operations::OpType::thermal_relaxation:
+    case Operations::OpType::roerror:
+    case Operations::OpType::bfunc:
+      noisy_ops.push_back(op);
+      return false;
+    // Switch noise on or off during current circuit sample
+    case Operations::OpType::noise_switch:
+      noise_active = static_cast<int>(std::real(op.params[0]));
+      return true;
+    default:
+      if (noise_active) {
+        // Ops without errors are added without sampling
+        if (errors.empty()) {
+          noisy_ops.push_back(op);
+          return false;
+        }
+        bool sampled = false;
+        NoiseOps noisy_op = sample_noise(op, errors, rng, &sampled);
+        noisy_ops.insert(noisy_ops.end(), noisy_op.begin(), noisy_op.end());
+        return sampled;
+      }
+      return true;
+  }
+}
+
+
+bool NoiseModel::sample_noise(const Operations::Op &op,
+                              const OpErrors &errors,
+                              bool &noise_active,
+                              NoiseOps &noise_before,
+                              NoiseOps &noise_after,
+                              RngEngine &rng) const {
+  if (method_ != Method::standard) {
+    throw std::runtime_error(
+      "NoiseModel: streaming noise sampling requires the standard method.");
+  }
+  switch (op.type) {
+    // Operations that cannot have noise
+    case Operations::OpType::barrier:
+    case Operations::OpType::snapshot:
+    case Operations::OpType::kraus:
+    case Operations::OpType::superop:
+    case Operations::OpType::thermal_relaxation:
+    case Operations::OpType::roerror:
+    case Operations::OpType::bfunc:
+      return true;
+    // Switch noise on or off during current circuit sample
+    case Operations::OpType::noise_switch:
+      noise_active = static_cast<int>(std::real(op.params[0]));
+      return false;
+    default:
+      break;
+  }
+  if (!noise_active)
+    return false;
+  if (errors.empty())
+    return true;
+  if (errors.waltz) {
+    const auto noisy_op = sample_noise(op, errors, rng);
+    noise_before.insert(noise_before.end(), noisy_op.begin(), noisy_op.end());
+    return false;
+  }
+  // Only non-identity error circuits are sampled, with the probability of
+  // any of them occurring
+  for (const auto &error : errors.quantum_errors) {
+    const auto &qerror = quantum_errors_[error.position];
+    const double p = qerror.error_probability();
+    if (!(p > 0.) || (p < 1. && rng.rand(0., 1.) >= p))
+      continue;
+    const auto noise_ops = qerror.error_circuit(qerror.sample_error(rng),
+                                                error.qubits);
+    auto &noise = (qerror.errors_after()) ? noise_after : noise_before;
+    noise.insert(noise.end(), noise_ops.begin(), noise_ops.end());
+  }
+  sample_readout_noise(errors, noise_after, rng);
+  return true;
+}
+
+
+NoiseModel::CircuitErrors NoiseModel::compile_errors(const Circuit &circ) const {
+  CircuitErrors errors;
+  errors.reserve(circ.ops.size());
+  for (const auto &op : circ.ops) {
+    errors.push_back(compile_errors(op));
+  }
+  return errors;
+}
+
+
+NoiseModel::OpErrors NoiseModel::compile_errors(const Operations::Op &op) const {
+  OpErrors errors;
+  switch (op.type) {
+    // Operations that cannot have noise
+    case Operations::OpType::barrier:
+    case Operations::OpType::snapshot:
+    case Operations::OpType::kraus:
+    case Operations::OpType::superop:
+    case Operations::OpType::thermal_relaxation:
+    case Operations::OpType::roerror:
+    case Operations::OpType::bfunc:
+    case Operations::OpType::noise_switch:
+      return errors;
+    default:
+      break;
+  }
+  // Waltz gates are sampled using the errors of their X90 pulses
+  if (x90_gates_.find(op.name) != x90_gates_.end()) {
+    errors.waltz = true;
+    if (!op.qubits.empty()) {
+      const auto x90 = Operations::make_unitary({op.qubits[0]},
+                                                Utils::Matrix::X90, "x90");
+      compile_local_quantum_errors(x90, errors);
+      compile_nonlocal_quantum_errors(x90, errors);
+    }
+    return errors;
+  }
+  // Local errors are sampled first, followed by nonlocal errors
+  compile_local_quantum_errors(op, errors);
+  compile_nonlocal_quantum_errors(op, errors);
+  // Readout errors are applied to measure ops
+  if (op.type == Operations::OpType::measure) {
+    compile_readout_errors(op, errors);
+  }
+  return errors;
+}
+
+
+//=========================================================================
+// Sparse noise sampling
+//=========================================================================
+
+bool NoiseModel::sparse_sampling_supported(const Circuit &circ,
+                                           const CircuitErrors &errors) const {
+  if (method_ != Method::standard || errors.size() != circ.ops.size())
+    return false;
+  for (size_t pos = 0; pos < circ.ops.size(); ++pos) {
+    if (circ.ops[pos].type == Operations::OpType::noise_switch ||
+        errors[pos].waltz)
+      return false;
+  }
+  return true;
+}
+
+
+double NoiseModel::expected_error_events(const CircuitErrors &errors) const {
+  double total = 0.;
+  for (const auto &op_errors : errors) {
+    for (const auto &error : op_errors.quantum_errors) {
+      total += quantum_errors_[error.position].error_probability();
+    }
+  }
+  return total;
+}
+
+
+std::map<NoiseModel::ErrorPattern, uint_t>
+NoiseModel::sample_error_patterns(const CircuitErrors &errors,
+                                  uint_t shots,
+                                  RngEngine &rng) const {
+  // Quantum error and error probability of each location
+  std::vector<size_t> positions;
+  rvector_t probs;
+  double max_prob = 0.;
+  for (const auto &op_errors : errors) {
+    for (const auto &error : op_errors.quantum_errors) {
+      positions.push_back(error.position);
+      probs.push_back(quantum_errors_[error.position].error_probability());
+      max_prob = std::max(max_prob, probs.back());
+    }
+  }
+
+  std::map<ErrorPattern, uint_t> patterns;
+  uint_t ideal_shots = shots;
+  if (max_prob > 0.) {
+    // The locations of all shots are visited in order by skipping a
+    // geometrically distributed number of locations for the largest error
+    // probability. Each visited location then has an error event with the
+    // ratio of its error probability to the largest.
+    const uint_t num_locations = probs.size();
+    const uint_t total = shots * num_locations;
+    const double log_q = std::log1p(-max_prob);
+    uint_t index = 0;
+    uint_t current_shot = 0;
+    ErrorPattern pattern;
+    while (true) {
+      if (max_prob < 1.) {
+        const double skip = std::floor(std::log1p(-rng.rand()) / log_q);
+        if (skip >= static_cast<double>(total - index))
           break;
+        index += static_cast<uint_t>(skip);
+      }
+      if (index >= total)
+        break;
+      const uint_t shot = index / num_locations;
+      const uint_t location = index % num_locations;
+      if (shot != current_shot && !pattern.empty()) {
+        patterns[pattern]++;
+        ideal_shots--;
+        pattern.clear();
       }
+      current_shot = shot;
+      if (rng.rand() * max_prob < probs[location]) {
+        pattern.push_back(
+            {location, quantum_errors_[positions[location]].sample_error(rng)});
+      }
+      index++;
     }
-    return noisy_circ;
+    if (!pattern.empty()) {
+      patterns[pattern]++;
+      ideal_shots--;
+    }
+  }
+  if (ideal_shots > 0)
+    patterns[ErrorPattern()] += ideal_shots;
+  return patterns;
+}
+
+
+Circuit NoiseModel::error_pattern_circuit(const Circuit &circ,
+                                          const CircuitErrors &errors,
+                                          const ErrorPattern &pattern,
+                                          RngEngine &rng) const {
+  if (errors.size() != circ.ops.size()) {
+    throw std::invalid_argument(
+      "NoiseModel: compiled errors do not match the circuit.");
+  }
+  Circuit noisy_circ = circ; // copy input circuit
+  noisy_circ.measure_sampling_flag = false; // disable measurement opt flag
+  noisy_circ.ops.clear(); // delete ops
+  noisy_circ.ops.reserve(circ.ops.size() + 2 * pattern.size());
+  auto event = pattern.cbegin();
+  uint_t location = 0;
+  for (size_t pos = 0; pos < circ.ops.size(); ++pos) {
+    const auto &op = circ.ops[pos];
+    if (errors[pos].empty()) {
+      noisy_circ.ops.push_back(op);
+      continue;
+    }
+    auto noisy_op = error_pattern_ops(op, errors[pos], location, event,
+                                      pattern.cend(), rng);
+    noisy_circ.ops.insert(noisy_circ.ops.end(), noisy_op.begin(), noisy_op.end());
+    location += errors[pos].quantum_errors.size();
+  }
+  return noisy_circ;
+}
+
+
+NoiseModel::NoiseOps
+NoiseModel::error_pattern_ops(const Operations::Op &op,
+                              const OpErrors &errors,
+                              uint_t location,
+                              ErrorPattern::const_iterator &event,
+                              const ErrorPattern::const_iterator &end,
+                              RngEngine &rng) const {
+  NoiseOps noise_before;
+  NoiseOps noise_after;
+  for (const auto &error : errors.quantum_errors) {
+    if (event != end && event->location == location) {
+      const auto &qerror = quantum_errors_[error.position];
+      auto noise_ops = qerror.error_circuit(event->circuit, error.qubits);
+      auto &noise = (qerror.errors_after()) ? noise_after : noise_before;
+      noise.insert(noise.end(), noise_ops.begin(), noise_ops.end());
+      ++event;
+    }
+    ++location;
+  }
+  sample_readout_noise(errors, noise_after, rng);
+  return combine_noise(op, noise_before, noise_after);
+}
+
+
+//=========================================================================
+// Pauli frame sampling
+//=========================================================================
+
+bool NoiseModel::pauli_errors(const CircuitErrors &errors) const {
+  const Operations::OpSet::optypeset_t pauli_ops({Operations::OpType::gate});
+  const stringset_t pauli_gates({"id", "x", "y", "z"});
+  for (const auto &op_errors : errors) {
+    for (const auto &error : op_errors.quantum_errors) {
+      if (!quantum_errors_[error.position].opset().validate(pauli_ops,
+                                                           pauli_gates, {}))
+        return false;
+    }
+  }
+  return true;
 }
 
 
@@ -427,19 +925,46 @@ void NoiseModel::add_nonlocal_quantum_error(const QuantumError &error,
 
 
 NoiseModel::NoiseOps NoiseModel::sample_noise_helper(const Operations::Op &op,
-                                                     RngEngine &rng) const {                                                
+                                                     const OpErrors &errors,
+                                                     RngEngine &rng,
+                                                     bool *sampled) const {
   // Return operator set
   NoiseOps noise_before;
   NoiseOps noise_after;
-  // Apply local errors first
-  sample_local_quantum_noise(op, noise_before, noise_after, rng);
-  // Apply nonlocal errors second
-  sample_nonlocal_quantum_noise(op, noise_before, noise_after, rng);
+  // Apply local errors first and nonlocal errors second
+  for (const auto &error : errors.quantum_errors) {
+    const auto &qerror = quantum_errors_[error.position];
+    auto noise_ops = qerror.sample_noise(error.qubits, rng, method_);
+    auto &noise = (qerror.errors_after()) ? noise_after : noise_before;
+    noise.insert(noise.end(), noise_ops.begin(), noise_ops.end());
+  }
   // Apply readout error to measure ops
-  if (op.type == Operations::OpType::measure) {
-    sample_readout_noise(op, noise_after, rng);
+  sample_readout_noise(errors, noise_after, rng);
+  if (sampled != nullptr)
+    *sampled = !noise_before.empty() || !noise_after.empty();
+  return combine_noise(op, noise_before, noise_after);
+}
+
+
+void NoiseModel::sample_readout_noise(const OpErrors &errors,
+                                      NoiseOps &noise_ops,
+                                      RngEngine &rng) const {
+  for (const auto &error : errors.readout_errors) {
+    auto readout_ops = readout_errors_[error.position].sample_noise(error.qubits, rng);
+    if (!error.registers.empty()) {
+      for (auto& noise_op: readout_ops) {
+        noise_op.registers = error.registers;
+      }
+    }
+    // Add noise after the error
+    noise_ops.insert(noise_ops.end(), readout_ops.begin(), readout_ops.end());
   }
+}
 
+
+NoiseModel::NoiseOps NoiseModel::combine_noise(const Operations::Op &op,
+                                               NoiseOps &noise_before,
+                                               const NoiseOps &noise_after) const {
   // Combine errors
   noise_before.reserve(noise_before.size() + noise_after.size() + 1);
   noise_before.push_back(op);
@@ -468,6 +993,16 @@ NoiseModel::NoiseOps NoiseModel::sample_noise_helper(const Operations::Op &op,
           current.mats[0] = mat * current.mats[0];
           return NoiseOps({current});
         }
+      } else if (method_ == Method::superop &&
+                 (first_op.type == Operations::OpType::thermal_relaxation ||
+                  second_op.type == Operations::OpType::thermal_relaxation)) {
+        // Natively applied errors are only combined with unitary matrices,
+        // such as the X90 pulses of waltz gates
+        if (first_op.type == Operations::OpType::matrix ||
+            second_op.type == Operations::OpType::matrix) {
+          const auto mat = op2superop(second_op) * op2superop(first_op);
+          return NoiseOps({Operations::make_superop(first_op.qubits, mat)});
+        }
       } else if (second_op.type == Operations::OpType::matrix) { 
         auto& current = noise_before[1];
         const auto mat = op2unitary(first_op);
@@ -489,9 +1024,165 @@ NoiseModel::NoiseOps NoiseModel::sample_noise_helper(const Operations::Op &op,
 }
 
 
-void NoiseModel::sample_readout_noise(const Operations::Op &op,
-                                      NoiseOps &noise_after,
+bool NoiseModel::sample_superop_noise(const Operations::Op &op,
+                                      const OpErrors &errors,
+                                      std::unordered_map<std::string, cmatrix_t> &cache,
+                                      NoiseOps &noisy_ops,
                                       RngEngine &rng) const {
+  if (errors.waltz || errors.quantum_errors.empty() ||
+      op.conditional || op.old_conditional)
+    return false;
+  // Errors on qubits outside of the operation and natively applied
+  // errors are not fused
+  for (const auto &error : errors.quantum_errors) {
+    if (quantum_errors_[error.position].native_channel())
+      return false;
+    const auto num_qubits = quantum_errors_[error.position].get_num_qubits();
+    for (size_t j = 0; j < num_qubits && j < error.qubits.size(); ++j) {
+      if (std::find(op.qubits.begin(), op.qubits.end(), error.qubits[j]) ==
+          op.qubits.end())
+        return false;
+    }
+  }
+  // Only gates are identified by their name, params and qubits
+  std::string key;
+  if (op.type == Operations::OpType::gate) {
+    std::stringstream ss;
+    ss.precision(17);
+    ss << op.name << op.qubits << op.params;
+    key = ss.str();
+    auto it = cache.find(key);
+    if (it != cache.end()) {
+      noisy_ops.push_back(Operations::make_superop(op.qubits, it->second));
+      sample_readout_noise(errors, noisy_ops, rng);
+      return true;
+    }
+  }
+  cmatrix_t mat = op2superop(op);
+  if (mat.empty())
+    return false;
+  // Errors before the operation are applied in reverse order on the right,
+  // and errors after it in order on the left
+  for (auto it = errors.quantum_errors.rbegin();
+       it != errors.quantum_errors.rend(); ++it) {
+    const auto &qerror = quantum_errors_[it->position];
+    if (qerror.errors_after())
+      continue;
+    reg_t qubits(it->qubits.begin(), it->qubits.begin() + qerror.get_num_qubits());
+    mat = mat * expand_superop(qerror.superoperator(), qubits, op.qubits);
+  }
+  for (const auto &error : errors.quantum_errors) {
+    const auto &qerror = quantum_errors_[error.position];
+    if (!qerror.errors_after())
+      continue;
+    reg_t qubits(error.qubits.begin(), error.qubits.begin() + qerror.get_num_qubits());
+    mat = expand_superop(qerror.superoperator(), qubits, op.qubits) * mat;
+  }
+  if (!key.empty())
+    cache[key] = mat;
+  noisy_ops.push_back(Operations::make_superop(op.qubits, mat));
+  sample_readout_noise(errors, noisy_ops, rng);
+  return true;
+}
+
+
+void NoiseModel::merge_superops(NoiseOps &ops) const {
+  auto mergeable = [](const Operations::Op &op) {
+    return op.type == Operations::OpType::superop && !op.qubits.empty() &&
+           !op.conditional && !op.old_conditional;
+  };
+  // Position of the last operation acting on each qubit
+  std::unordered_map<uint_t, size_t> last;
+  std::vector<bool> merged(ops.size(), false);
+  for (size_t pos = 0; pos < ops.size(); ++pos) {
+    auto &op = ops[pos];
+    if (mergeable(op) && op.qubits.size() == 1) {
+      // Merge into the previous superop acting on the qubit
+      auto it = last.find(op.qubits[0]);
+      if (it != last.end() && mergeable(ops[it->second])) {
+        auto &prev = ops[it->second];
+        prev.mats[0] = expand_superop(op.mats[0], op.qubits, prev.qubits) * prev.mats[0];
+        merged[pos] = true;
+        continue;
+      }
+    } else if (mergeable(op)) {
+      // Merge the previous single-qubit superops acting on its qubits
+      for (const auto &qubit : op.qubits) {
+        auto it = last.find(qubit);
+        if (it == last.end() || merged[it->second])
+          continue;
+        const auto &prev = ops[it->second];
+        if (mergeable(prev) && prev.qubits.size() == 1) {
+          op.mats[0] = op.mats[0] * expand_superop(prev.mats[0], prev.qubits, op.qubits);
+          merged[it->second] = true;
+        }
+      }
+    }
+    // Operations without qubits, such as snapshots, act on every qubit
+    if (op.qubits.empty())
+      last.clear();
+    for (const auto &qubit : op.qubits)
+      last[qubit] = pos;
+  }
+  size_t num_ops = 0;
+  for (size_t pos = 0; pos < ops.size(); ++pos) {
+    if (!merged[pos]) {
+      if (num_ops != pos)
+        ops[num_ops] = std::move(ops[pos]);
+      ++num_ops;
+    }
+  }
+  ops.resize(num_ops);
+}
+
+
+cmatrix_t NoiseModel::expand_superop(const cmatrix_t &mat,
+                                     const reg_t &qubits,
+                                     const reg_t &dst_qubits) {
+  if (qubits == dst_qubits)
+    return mat;
+  // The vectorized superop acts on the row and then the column index of
+  // the density matrix for each qubit, so the index bits of the superop
+  // on qubits are moved to the positions of the qubits in dst_qubits
+  const uint_t N = qubits.size();
+  const uint_t M = dst_qubits.size();
+  reg_t positions(2 * N);
+  uint_t mask = 0;
+  for (size_t i = 0; i < N; ++i) {
+    auto it = std::find(dst_qubits.begin(), dst_qubits.end(), qubits[i]);
+    if (it == dst_qubits.end()) {
+      throw std::invalid_argument(
+        "NoiseModel: superop qubits are not contained in the target qubits.");
+    }
+    positions[i] = it - dst_qubits.begin();
+    positions[N + i] = M + positions[i];
+    mask |= (1ULL << positions[i]) | (1ULL << positions[N + i]);
+  }
+  const uint_t dim = 1ULL << (2 * M);
+  const uint_t sub_dim = 1ULL << (2 * N);
+  // Index in the expanded superop of each index of the input superop
+  reg_t deposit(sub_dim, 0);
+  for (uint_t k = 0; k < sub_dim; ++k) {
+    for (size_t i = 0; i < 2 * N; ++i) {
+      if ((k >> i) & 1)
+        deposit[k] |= (1ULL << positions[i]);
+    }
+  }
+  cmatrix_t expanded(dim, dim);
+  for (uint_t rest = 0; rest < dim; ++rest) {
+    if (rest & mask)
+      continue;
+    for (uint_t row = 0; row < sub_dim; ++row) {
+      for (uint_t col = 0; col < sub_dim; ++col)
+        expanded(rest | deposit[row], rest | deposit[col]) = mat(row, col);
+    }
+  }
+  return expanded;
+}
+
+
+void NoiseModel::compile_readout_errors(const Operations::Op &op,
+                                        OpErrors &errors) const {
   // If no readout errors are defined pass
   if (readout_errors_.empty()) {
     return;
@@ -542,25 +1233,16 @@ void NoiseModel::sample_readout_noise(const Operations::Op &op,
         ? iter_qubits->second
         : iter_default->second;
       for (auto &pos : error_positions) {
-        // Sample Readout error
-        auto noise_ops = readout_errors_[pos].sample_noise(memory_sets[qs], rng);
-        if (has_registers) {
-          for (auto& noise_op: noise_ops) {
-            noise_op.registers = registers_sets[qs];
-          }
-        }
-        // Add noise after the error 
-        noise_after.insert(noise_after.end(), noise_ops.begin(), noise_ops.end());
+        errors.readout_errors.push_back(
+          {pos, memory_sets[qs], (has_registers) ? registers_sets[qs] : reg_t()});
       }
     }
   }
 }
 
 
-void NoiseModel::sample_local_quantum_noise(const Operations::Op &op,
-                                            NoiseOps &noise_before,
-                                            NoiseOps &noise_after,
-                                            RngEngine &rng) const {
+void NoiseModel::compile_local_quantum_errors(const Operations::Op &op,
+                                              OpErrors &errors) const {
   
   // If no errors are defined pass
   if (local_quantum_errors_ == false)
@@ -583,7 +1265,7 @@ void NoiseModel::sample_local_quantum_noise(const Operations::Op &op,
   auto iter = local_quantum_error_table_.find(name);
   if (iter != local_quantum_error_table_.end()) {
     // Check if the qubits are listed in the inner model
-    const auto qubit_map = iter->second;
+    const auto &qubit_map = iter->second;
     // Get the default qubit model in case a specific qubit model is not found
     // The default model is stored under the empty key string ""
     auto iter_default = qubit_map.find(std::string());
@@ -601,20 +1283,16 @@ void NoiseModel::sample_local_quantum_noise(const Operations::Op &op,
       // for gate operations we use the qubits as specified
       qubit_keys.push_back(op_qubits);
     }
-    for(auto qubit_key: qubit_keys){
+    for (const auto &qubit_key: qubit_keys) {
       auto iter_qubits = qubit_map.find(qubit_key);
       if (iter_qubits != qubit_map.end() ||
           iter_default != qubit_map.end()) {
         auto &error_positions = (iter_qubits != qubit_map.end())
           ? iter_qubits->second
           : iter_default->second;
+        const auto qubits = string2reg(qubit_key);
         for (auto &pos : error_positions) {
-          auto noise_ops = quantum_errors_[pos].sample_noise(string2reg(qubit_key), rng, method_);
-          // Duplicate same sampled error operations
-          if (quantum_errors_[pos].errors_after())
-            noise_after.insert(noise_after.end(), noise_ops.begin(), noise_ops.end());
-          else
-            noise_before.insert(noise_before.end(), noise_ops.begin(), noise_ops.end());
+          errors.quantum_errors.push_back({pos, qubits, reg_t()});
         }
       }
     }
@@ -622,10 +1300,8 @@ void NoiseModel::sample_local_quantum_noise(const Operations::Op &op,
 }
 
 
-void NoiseModel::sample_nonlocal_quantum_noise(const Operations::Op &op,
-                                               NoiseOps &noise_before,
-                                               NoiseOps &noise_after,
-                                               RngEngine &rng) const {
+void NoiseModel::compile_nonlocal_quantum_errors(const Operations::Op &op,
+                                                 OpErrors &errors) const {
   
   // If no errors are defined pass
   if (nonlocal_quantum_errors_ == false)
@@ -642,7 +1318,7 @@ void NoiseModel::sample_nonlocal_quantum_noise(const Operations::Op &op,
   // Get the inner error map for  gate name
   auto iter = nonlocal_quantum_error_table_.find(name);
   if (iter != nonlocal_quantum_error_table_.end()) {
-    const auto qubit_map = iter->second;
+    const auto &qubit_map = iter->second;
     // Format qubit sets
     std::vector<std::string> qubit_keys;
 
@@ -665,13 +1341,9 @@ void NoiseModel::sample_nonlocal_quantum_noise(const Operations::Op &op,
         for (auto &target_pair : iter_qubits->second) {
           auto &target_qubits = target_pair.first;
           auto &error_positions = target_pair.second;
+          const auto noise_qubits = string2reg(target_qubits);
           for (auto &pos : error_positions) {
-            auto ops = quantum_errors_[pos].sample_noise(string2reg(target_qubits), rng,
-                                                         method_);
-            if (quantum_errors_[pos].errors_after())
-              noise_after.insert(noise_after.end(), ops.begin(), ops.end());
-            else
-              noise_before.insert(noise_before.end(), ops.begin(), ops.end());
+            errors.quantum_errors.push_back({pos, noise_qubits, reg_t()});
           }
         }
       }
@@ -693,13 +1365,14 @@ NoiseModel::NoiseOps NoiseModel::sample_noise_x90_u3(uint_t qubit,
                                                      complex_t theta,
                                                      complex_t phi,
                                                      complex_t lambda,
+                                                     const OpErrors &errors,
                                                      RngEngine &rng) const {
   // sample noise for single X90
   const auto x90 = Operations::make_unitary({qubit}, Utils::Matrix::X90, "x90");
   switch (method_) {
     case Method::superop: {
       // The first element of the sample should be the superoperator to combine
-      auto sample = sample_noise_helper(x90, rng);
+      auto sample = sample_noise_helper(x90, errors, rng);
       // The first element of the sample should be the superoperator to combine
       if (sample[0].type != Operations::OpType::superop) {
         throw std::runtime_error("Sampling superoperator noise failed.");
@@ -728,13 +1401,13 @@ NoiseModel::NoiseOps NoiseModel::sample_noise_x90_u3(uint_t qubit,
           && std::abs(lambda + 2 * M_PI) > u1_threshold_) {
         ret.push_back(Operations::make_u1(qubit, lambda)); // add 1st U1
       }
-      auto sample = sample_noise_helper(x90, rng); // sample noise for 1st X90
+      auto sample = sample_noise_helper(x90, errors, rng); // sample noise for 1st X90
       ret.insert(ret.end(), sample.begin(), sample.end()); // add 1st noisy X90
       if (std::abs(theta + M_PI) > u1_threshold_
           && std::abs(theta - M_PI) > u1_threshold_) {
         ret.push_back(Operations::make_u1(qubit, theta + M_PI)); // add 2nd U1
       }
-      sample = sample_noise_helper(x90, rng); // sample noise for 2nd X90
+      sample = sample_noise_helper(x90, errors, rng); // sample noise for 2nd X90
       ret.insert(ret.end(), sample.begin(), sample.end()); // add 2nd noisy X90
       if (std::abs(phi + M_PI) > u1_threshold_
           && std::abs(phi - M_PI) > u1_threshold_) {
@@ -749,10 +1422,11 @@ NoiseModel::NoiseOps NoiseModel::sample_noise_x90_u3(uint_t qubit,
 NoiseModel::NoiseOps NoiseModel::sample_noise_x90_u2(uint_t qubit,
                                                      complex_t phi,
                                                      complex_t lambda,
+                                                     const OpErrors &errors,
                                                      RngEngine &rng) const {
   // sample noise for single X90
   const auto x90 = Operations::make_unitary({qubit}, Utils::Matrix::X90, "x90");
-  auto sample = sample_noise_helper(x90, rng); 
+  auto sample = sample_noise_helper(x90, errors, rng); 
   switch (method_) {
     case Method::superop: {
       // The first element of the sample should be the superoperator to combine
@@ -804,6 +1478,22 @@ cmatrix_t NoiseModel::op2superop(const Operations::Op &op) const {
     }
     case Operations::OpType::reset:
       return Utils::SMatrix::reset(1ULL << op.qubits.size());
+    case Operations::OpType::thermal_relaxation: {
+      // Populations are the diagonal elements 0 and 3 of the vectorized
+      // density matrix, and coherences the elements 1 and 2
+      const auto channel = Operations::thermal_relaxation_channel(op);
+      const double keep = 1. - channel.p_reset;
+      const double reset0 = channel.p_reset * (1. - channel.p_excited);
+      const double reset1 = channel.p_reset * channel.p_excited;
+      cmatrix_t mat(4, 4);
+      mat(0, 0) = keep + reset0;
+      mat(0, 3) = reset0;
+      mat(3, 0) = reset1;
+      mat(3, 3) = keep + reset1;
+      mat(1, 1) = channel.coherence;
+      mat(2, 2) = channel.coherence;
+      return mat;
+    }
     case  Operations::OpType::matrix:
       return Utils::unitary_superop(op.mats[0]);
     case Operations::OpType::gate: {
@@ -835,17 +1525,17 @@ cmatrix_t NoiseModel::op2unitary(const Operations::Op &op) const {
   case Operations::OpType::gate:  {
     // Check if a parameterized gate
     if (op.name == "u1") {
-     return Utils::SMatrix::u1(op.params[0]);
+     return Utils::Matrix::u1(op.params[0]);
     }
     if (op.name == "u2") {
-      return Utils::SMatrix::u2(op.params[0], op.params[1]);
+      return Utils::Matrix::u2(op.params[0], op.params[1]);
     }
     if (op.name == "u3") {
-      return Utils::SMatrix::u3(op.params[0], op.params[1], op.params[2]);
+      return Utils::Matrix::u3(op.params[0], op.params[1], op.params[2]);
     }
-    if (Utils::SMatrix::allowed_name(op.name)) {
-      // Check if we can convert this gate to a standard superoperator matrix
-      return Utils::SMatrix::from_name(op.name);
+    if (Utils::Matrix::allowed_name(op.name)) {
+      // Check if we can convert this gate to a standard unitary matrix
+      return Utils::Matrix::from_name(op.name);
     }
   }
   default:
@@ -1042,43 +1732,54 @@ void NoiseModel::load_from_json(const json_t &js) {
       throw std::invalid_argument("Invalid noise_params JSON: \"error\" field is not a list");
     }
     for (const auto &gate_js : js["errors"]) {
-      std::string type;
-      JSON::get_value(type, "type", gate_js);
-      stringset_t ops; // want set so ops are unique, and we can pull out measure
-      JSON::get_value(ops, "operations", gate_js);
-      std::vector<reg_t> gate_qubits;
-      JSON::get_value(gate_qubits, "gate_qubits", gate_js);
-      std::vector<reg_t> noise_qubits;
-      JSON::get_value(noise_qubits, "noise_qubits", gate_js);
-
-      // We treat measure as a separate error op so that it can be applied before
-      // the measure operation, rather than after like the other gates
-      if (ops.find("measure") != ops.end() && type != "roerror") {
-        ops.erase("measure"); // remove measure from set of ops
-        if (type != "qerror")
-          throw std::invalid_argument("NoiseModel: Invalid noise type (" + type + ")");
-        QuantumError error;
-        error.load_from_json(gate_js);
-        error.set_errors_before(); // set errors before the op
-        add_quantum_error(error, {"measure"}, gate_qubits, noise_qubits);
-      }
-      // Load the remaining ops as errors that come after op
-      if (type == "qerror") {
-        QuantumError error;
-        error.load_from_json(gate_js);
-        add_quantum_error(error, ops, gate_qubits, noise_qubits);
-      } else if (type == "roerror") {
-        // We do not allow non-local readout errors
-        if (!noise_qubits.empty()) {
-          throw std::invalid_argument("Readout error must be a local error");
-        }
-        ReadoutError error; // readout error goes after
-        error.load_from_json(gate_js);
-        add_readout_error(error, gate_qubits);
-      }else {
-        throw std::invalid_argument("NoiseModel: Invalid noise type (" + type + ")");
-      }
+      add_error_from_json(gate_js);
+    }
+  }
+}
+
+void NoiseModel::add_error_from_json(const json_t &js) {
+  std::string type;
+  JSON::get_value(type, "type", js);
+  QuantumError error;
+  if (type == "qerror")
+    error.load_from_json(js);
+  add_error_from_json(js, error);
+}
+
+void NoiseModel::add_error_from_json(const json_t &js,
+                                     const QuantumError &error) {
+  std::string type;
+  JSON::get_value(type, "type", js);
+  stringset_t ops; // want set so ops are unique, and we can pull out measure
+  JSON::get_value(ops, "operations", js);
+  std::vector<reg_t> gate_qubits;
+  JSON::get_value(gate_qubits, "gate_qubits", js);
+  std::vector<reg_t> noise_qubits;
+  JSON::get_value(noise_qubits, "noise_qubits", js);
+
+  // We treat measure as a separate error op so that it can be applied before
+  // the measure operation, rather than after like the other gates
+  if (ops.find("measure") != ops.end() && type != "roerror") {
+    ops.erase("measure"); // remove measure from set of ops
+    if (type != "qerror")
+      throw std::invalid_argument("NoiseModel: Invalid noise type (" + type + ")");
+    QuantumError measure_error = error;
+    measure_error.set_errors_before(); // set errors before the op
+    add_quantum_error(measure_error, {"measure"}, gate_qubits, noise_qubits);
+  }
+  // Load the remaining ops as errors that come after op
+  if (type == "qerror") {
+    add_quantum_error(error, ops, gate_qubits, noise_qubits);
+  } else if (type == "roerror") {
+    // We do not allow non-local readout errors
+    if (!noise_qubits.empty()) {
+      throw std::invalid_argument("Readout error must be a local error");
     }
+    ReadoutError roerror; // readout error goes after
+    roerror.load_from_json(js);
+    add_readout_error(roerror, gate_qubits);
+  }else {
+    throw std::invalid_argument("NoiseModel: Invalid noise type (" + type + ")");
   }
 }
 
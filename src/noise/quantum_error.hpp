@@ -45,6 +45,20 @@ public:
                         RngEngine &rng,
                         Method method = Method::standard) const;
 
+  // Return the probability of sampling an error circuit that is not
+  // the identity
+  inline double error_probability() const {return error_probability_;}
+
+  // Sample the position of a non-identity error circuit conditioned on
+  // a non-identity error occurring
+  uint_t sample_error(RngEngine &rng) const;
+
+  // Return the error circuit at the specified position applied to qubits
+  NoiseOps error_circuit(uint_t position, const reg_t &qubits) const;
+
+  // Return the error circuits with qubits relative to the error qubits
+  const std::vector<NoiseOps>& circuits() const {return circuits_;}
+
   // Return the opset for the quantum error
   const Operations::OpSet& opset() const {return opset_;}
 
@@ -92,6 +106,11 @@ public:
   // Returns true if the errors are to be applied after the operation
   inline bool errors_after() const {return errors_after_op_;}
 
+  // Returns true if the error is a single circuit of thermal relaxation
+  // ops, which are applied natively by the superop method rather than
+  // as a superoperator matrix
+  inline bool native_channel() const {return native_channel_;}
+
   // Set threshold for checking probabilities and matrices
   void set_threshold(double);
 
@@ -102,6 +121,17 @@ protected:
   // Probabilities, first entry is no-error (identity)
   rvector_t probabilities_;
 
+  // Alias table for sampling the error circuits from probabilities
+  AliasTable probabilities_table_;
+
+  // Total probability of the non-identity error circuits
+  double error_probability_ = 0.;
+
+  // Positions of the non-identity error circuits and an alias table for
+  // sampling them conditioned on an error occurring
+  std::vector<uint_t> error_positions_;
+  AliasTable error_table_;
+
   // List of unitary error matrices
   std::vector<NoiseOps> circuits_;
 
@@ -116,6 +146,9 @@ protected:
 
   // flag for where errors should be applied relative to the sampled op
   bool errors_after_op_ = true;  
+
+  // flag for errors of natively applied thermal relaxation ops
+  bool native_channel_ = false;
 };
 
 //-------------------------------------------------------------------------
@@ -134,6 +167,8 @@ QuantumError::NoiseOps QuantumError::sample_noise(const reg_t &qubits,
   }
   switch (method) {
     case Method::superop: {
+      if (native_channel_)
+        return error_circuit(0, qubits);
       // Truncate qubits to size of the actual error
       reg_t op_qubits = qubits;
       op_qubits.resize(get_num_qubits());
@@ -141,27 +176,40 @@ QuantumError::NoiseOps QuantumError::sample_noise(const reg_t &qubits,
       return NoiseOps({op});
     }
     default: {
-      auto r = rng.rand_int(probabilities_);
-      // Check for invalid arguments
-      if (r + 1 > circuits_.size()) {
-        throw std::invalid_argument(
-          "QuantumError: probability outcome (" + std::to_string(r) + ")"
-          " is greater than number of circuits (" + std::to_string(circuits_.size()) + ")."
-        );
-      }
-      NoiseOps noise_ops = circuits_[r];
-      // Add qubits to noise op commands;
-      for (auto &op : noise_ops) {
-        // Update qubits based on position in qubits list
-        for (auto &qubit: op.qubits) {
-          qubit = qubits[qubit];
-        }
-      }
-      return noise_ops;
+      auto r = rng.rand_int(probabilities_table_);
+      return error_circuit(r, qubits);
     }
   }
 }
 
+uint_t QuantumError::sample_error(RngEngine &rng) const {
+  if (error_positions_.empty()) {
+    throw std::invalid_argument(
+      "QuantumError: cannot sample an error with no non-identity circuits.");
+  }
+  return error_positions_[rng.rand_int(error_table_)];
+}
+
+QuantumError::NoiseOps QuantumError::error_circuit(uint_t position,
+                                                   const reg_t &qubits) const {
+  // Check for invalid arguments
+  if (position + 1 > circuits_.size()) {
+    throw std::invalid_argument(
+      "QuantumError: probability outcome (" + std::to_string(position) + ")"
+      " is greater than number of circuits (" + std::to_string(circuits_.size()) + ")."
+    );
+  }
+  NoiseOps noise_ops = circuits_[position];
+  // Add qubits to noise op commands;
+  for (auto &op : noise_ops) {
+    // Update qubits based on position in qubits list
+    for (auto &qubit: op.qubits) {
+      qubit = qubits[qubit];
+    }
+  }
+  return noise_ops;
+}
+
 void QuantumError::set_threshold(double threshold) {
   threshold_ = std::abs(threshold);
 }
@@ -204,6 +252,30 @@ void QuantumError::set_circuits(const std::vector<NoiseOps> &circuits,
       }
     }
   }
+  if (!probabilities_.empty())
+    probabilities_table_ = AliasTable(probabilities_);
+  native_channel_ = circuits_.size() == 1 && !circuits_[0].empty() &&
+    std::all_of(circuits_[0].begin(), circuits_[0].end(),
+                [](const Operations::Op &op) {
+                  return op.type == Operations::OpType::thermal_relaxation;
+                });
+  // Circuits of only identity gates are not errors
+  error_probability_ = 0.;
+  error_positions_.clear();
+  rvector_t error_probs;
+  for (size_t j = 0; j < circuits_.size(); j++) {
+    const bool identity = std::all_of(
+      circuits_[j].begin(), circuits_[j].end(), [](const Operations::Op &op) {
+        return op.type == Operations::OpType::gate && op.name == "id";
+      });
+    if (!identity) {
+      error_probability_ += probabilities_[j];
+      error_positions_.push_back(j);
+      error_probs.push_back(probabilities_[j]);
+    }
+  }
+  if (!error_probs.empty())
+    error_table_ = AliasTable(error_probs);
   set_num_qubits(num_qubits);
 }
 
@@ -277,6 +349,7 @@ void QuantumError::set_from_kraus(const std::vector<cmatrix_t> &mats) {
   // Add identity
   Operations::Op iden;
   iden.name = "id";
+  iden.gate = Operations::GateID::id;
   iden.qubits = reg_t({0});
   iden.type = Operations::OpType::gate;
   circuits.push_back({iden});
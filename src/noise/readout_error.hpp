@@ -69,6 +69,10 @@ protected:
   // Vector of assignment probability vectors
   std::vector<rvector_t> assignment_probabilities_; 
 
+  // Alias tables for sampling the assignment probabilities, which are
+  // shared by the sampled readout error ops
+  std::shared_ptr<const std::vector<AliasTable>> assignment_tables_;
+
   // threshold for checking probabilities
   double threshold_ = 1e-10;
 };
@@ -84,7 +88,8 @@ ReadoutError::NoiseOps ReadoutError::sample_noise(const reg_t &memory,
   if (memory.size() > get_num_qubits())
     throw std::invalid_argument("ReadoutError: number of qubits don't match assignment probability matrix.");
   // Initialize return ops,
-  return {Operations::make_roerror(memory, assignment_probabilities_)};
+  return {Operations::make_roerror(memory, assignment_probabilities_,
+                                   assignment_tables_)};
 }
 
 
@@ -102,6 +107,7 @@ void ReadoutError::set_probabilities(const std::vector<rvector_t> &probs) {
     if (std::abs(total - 1) > threshold_)
       throw std::invalid_argument("ReadoutError probability vector is not normalized.");
   }
+  assignment_tables_ = Operations::make_alias_tables(assignment_probabilities_);
 }
 
 
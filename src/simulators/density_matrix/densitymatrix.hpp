@@ -112,6 +112,12 @@ public:
   // Apply a 3-qubit toffoli gate
   void apply_toffoli(const uint_t qctrl0, const uint_t qctrl1, const uint_t qtrgt);
 
+  // Apply a single-qubit thermal relaxation channel which relaxes the
+  // populations to (1 - p_excited, p_excited) with probability p_reset
+  // and scales the coherences by the coherence factor
+  void apply_thermal_relaxation(const uint_t qubit, const double p_reset,
+                                const double p_excited, const double coherence);
+
   //-----------------------------------------------------------------------
   // Z-measurement outcome probabilities
   //-----------------------------------------------------------------------
@@ -340,6 +346,28 @@ void DensityMatrix<data_t>::apply_toffoli(const uint_t qctrl0,
   BaseVector::apply_permutation_matrix(qubits, pairs);
 }
 
+template <typename data_t>
+void DensityMatrix<data_t>::apply_thermal_relaxation(const uint_t qubit,
+                                                     const double p_reset,
+                                                     const double p_excited,
+                                                     const double coherence) {
+  const data_t keep = 1. - p_reset;
+  const data_t reset0 = p_reset * (1. - p_excited);
+  const data_t reset1 = p_reset * p_excited;
+  const data_t scale = coherence;
+  // Lambda function updating the populations and coherences of the qubit
+  auto lambda = [&](const areg_t<1ULL << 2> &inds)->void {
+    const std::complex<data_t> trace = BaseVector::data_[inds[0]] + BaseVector::data_[inds[3]];
+    BaseVector::data_[inds[0]] = keep * BaseVector::data_[inds[0]] + reset0 * trace;
+    BaseVector::data_[inds[3]] = keep * BaseVector::data_[inds[3]] + reset1 * trace;
+    BaseVector::data_[inds[1]] *= scale;
+    BaseVector::data_[inds[2]] *= scale;
+  };
+  // Use the lambda function
+  const areg_t<2> qubits = {{qubit, qubit + num_qubits()}};
+  BaseVector::apply_lambda(lambda, qubits);
+}
+
 //-----------------------------------------------------------------------
 // Z-measurement outcome probabilities
 //-----------------------------------------------------------------------
@@ -78,7 +78,8 @@ public:
       Operations::OpType::roerror,
       Operations::OpType::matrix,
       Operations::OpType::kraus,
-      Operations::OpType::superop
+      Operations::OpType::superop,
+      Operations::OpType::thermal_relaxation
     });
   }
 
@@ -100,6 +101,12 @@ public:
                          ExperimentData &data,
                          RngEngine &rng) override;
 
+  // Apply the sequence of operations [first, last) by looping over it
+  virtual void apply_ops_range(const Operations::Op *first,
+                               const Operations::Op *last,
+                               ExperimentData &data,
+                               RngEngine &rng) override;
+
   // Initializes an n-qubit state to the all |0> state
   virtual void initialize_qreg(uint_t num_qubits) override;
 
@@ -249,6 +256,9 @@ protected:
   // Table of allowed gate names to gate enum class members
   const static stringmap_t<Gates> gateset_;
 
+  // Table of the gates of gateset_ indexed by gate identifier
+  const static Operations::GateTable<Gates> gate_table_;
+
   // Table of allowed snapshot types to enum class members
   const static stringmap_t<Snapshots> snapshotset_;
 
@@ -285,6 +295,9 @@ const stringmap_t<Gates> State<densmat_t>::gateset_({
   {"ccx", Gates::ccx}    // Controlled-CX gate (Toffoli)
 });
 
+template <class densmat_t>
+const Operations::GateTable<Gates> State<densmat_t>::gate_table_(gateset_);
+
 
 template <class densmat_t>
 const stringmap_t<Snapshots> State<densmat_t>::snapshotset_({
@@ -388,8 +401,17 @@ template <class densmat_t>
 void State<densmat_t>::apply_ops(const std::vector<Operations::Op> &ops,
                                  ExperimentData &data,
                                  RngEngine &rng) {
-  // Simple loop over vector of input operations
-  for (const auto op: ops) {
+  apply_ops_range(ops.data(), ops.data() + ops.size(), data, rng);
+}
+
+template <class densmat_t>
+void State<densmat_t>::apply_ops_range(const Operations::Op *first,
+                                       const Operations::Op *last,
+                                       ExperimentData &data,
+                                       RngEngine &rng) {
+  // Simple loop over range of input operations
+  for (auto it = first; it != last; ++it) {
+    const auto &op = *it;
     // If conditional op check conditional
     if (BaseState::creg_.check_conditional(op) == false)
       return;
@@ -423,6 +445,12 @@ void State<densmat_t>::apply_ops(const std::vector<Operations::Op> &ops,
       case Operations::OpType::kraus:
         apply_kraus(op.qubits, op.mats);
         break;
+      case Operations::OpType::thermal_relaxation: {
+        const auto channel = Operations::thermal_relaxation_channel(op);
+        BaseState::qreg_.apply_thermal_relaxation(op.qubits[0], channel.p_reset,
+                                                  channel.p_excited, channel.coherence);
+        break;
+      }
       default:
         throw std::invalid_argument("DensityMatrix::State::invalid instruction \'" +
                                     op.name + "\'.");
@@ -509,12 +537,12 @@ void State<densmat_t>::snapshot_probabilities(const Operations::Op &op,
 
 template <class densmat_t>
 void State<densmat_t>::apply_gate(const Operations::Op &op) {
-  // Look for gate name in gateset
-  auto it = gateset_.find(op.name);
-  if (it == gateset_.end())
+  // Look up the gate of the op in the gate table
+  auto it = gate_table_.find(op);
+  if (it == nullptr)
     throw std::invalid_argument("DensityMatrixState::invalid gate instruction \'" + 
                                 op.name + "\'.");
-  switch (it -> second) {
+  switch (*it) {
     case Gates::u3:
       apply_gate_u3(op.qubits[0],
                     std::real(op.params[0]),
@@ -116,6 +116,12 @@ public:
   // Apply a 3-qubit toffoli gate
   void apply_toffoli(const uint_t qctrl0, const uint_t qctrl1, const uint_t qtrgt);
 
+  // Apply a single-qubit thermal relaxation channel which relaxes the
+  // populations to (1 - p_excited, p_excited) with probability p_reset
+  // and scales the coherences by the coherence factor
+  void apply_thermal_relaxation(const uint_t qubit, const double p_reset,
+                                const double p_excited, const double coherence);
+
   //-----------------------------------------------------------------------
   // Z-measurement outcome probabilities
   //-----------------------------------------------------------------------
@@ -376,6 +382,67 @@ public:
 
 };
 
+template <typename data_t>
+class DensityThermalRelaxation : public GateFuncBase
+{
+protected:
+  uint_t mask0;
+  uint_t mask1;
+  data_t keep;
+  data_t reset0;
+  data_t reset1;
+  data_t scale;
+
+public:
+  DensityThermalRelaxation(int q0,int q1,double p_reset,double p_excited,double coherence)
+  {
+  	if(q0 < q1){
+      mask0 = (1ull << q0) - 1;
+      mask1 = (1ull << q1) - 1;
+  	}
+  	else{
+      mask0 = (1ull << q1) - 1;
+      mask1 = (1ull << q0) - 1;
+  	}
+    keep = 1. - p_reset;
+    reset0 = p_reset * (1. - p_excited);
+    reset1 = p_reset * p_excited;
+    scale = coherence;
+  }
+
+	__host__ __device__ double operator()(const thrust::tuple<uint_t,struct GateParams<data_t>> &iter) const
+  {
+    uint_t i,i0,i1,i2;
+	thrust::complex<data_t>* pV;
+	uint_t* offsets;
+    thrust::complex<data_t> q0,q3,trace;
+		struct GateParams<data_t> params;
+
+  	i = ExtractIndexFromTuple(iter);
+		params = ExtractParamsFromTuple(iter);
+		pV = params.buf_;
+		offsets = params.offsets_;
+
+    i0 = i & mask0;
+    i2 = (i - i0) << 1;
+    i1 = i2 & mask1;
+    i2 = (i2 - i1) << 1;
+
+    i0 = i0 + i1 + i2;
+
+    q0 = pV[offsets[0]+i0];
+    q3 = pV[offsets[3]+i0];
+    trace = q0 + q3;
+
+    pV[offsets[0]+i0] = keep * q0 + reset0 * trace;
+    pV[offsets[1]+i0] *= scale;
+    pV[offsets[2]+i0] *= scale;
+    pV[offsets[3]+i0] = keep * q3 + reset1 * trace;
+		return 0.0;
+  }
+
+};
+
 template <typename data_t>
 void DensityMatrixThrust<data_t>::apply_x(const uint_t qubit) {
   // Use the lambda function
@@ -389,6 +456,23 @@ void DensityMatrixThrust<data_t>::apply_x(const uint_t qubit) {
 #endif
 }
 
+template <typename data_t>
+void DensityMatrixThrust<data_t>::apply_thermal_relaxation(const uint_t qubit,
+                                                           const double p_reset,
+                                                           const double p_excited,
+                                                           const double coherence) {
+  const reg_t qubits = {{qubit, qubit + num_qubits()}};
+
+	BaseVector::apply_function(DensityThermalRelaxation<data_t>(qubits[0], qubits[1],
+                                                               p_reset, p_excited, coherence),
+                             qubits);
+
+#ifdef AER_DEBUG
+	BaseVector::DebugMsg(" density::apply_thermal_relaxation",qubits);
+	BaseVector::DebugDump();
+#endif
+}
+
 template <typename data_t>
 void DensityMatrixThrust<data_t>::apply_y(const uint_t qubit) {
   cvector_t<double> vec;
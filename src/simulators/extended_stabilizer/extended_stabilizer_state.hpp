@@ -140,6 +140,9 @@ protected:
   void probabilities_snapshot(const Operations::Op &op, ExperimentData &data, RngEngine &rng);
 
   const static stringmap_t<Gates> gateset_;
+
+  // Table of the gates of gateset_ indexed by gate identifier
+  const static Operations::GateTable<Gates> gate_table_;
   const static stringmap_t<Snapshots> snapshotset_;
 
   //-----------------------------------------------------------------------
@@ -207,6 +210,8 @@ const stringmap_t<Gates> State::gateset_({
   {"ccz", Gates::ccz}     // Constrolled-CZ gate (H3 Toff H3)
 });
 
+const Operations::GateTable<Gates> State::gate_table_(gateset_);
+
 const stringmap_t<Snapshots> State::snapshotset_({
   {"state", Snapshots::state},
   {"statevector", Snapshots::statevector},
@@ -256,7 +261,7 @@ std::pair<uint_t, uint_t> State::decomposition_parameters(const std::vector<Oper
 {
   double xi=1.;
   unsigned three_qubit_gate_count = 0;
-  for (const auto op: ops)
+  for (const auto &op: ops)
   {
     if (op.type == Operations::OpType::gate)
     {
@@ -301,7 +306,7 @@ std::pair<bool, size_t> State::check_stabilizer_opt(const std::vector<Operations
 
 bool State::check_measurement_opt(const std::vector<Operations::Op> &ops) const
 {
-  for (const auto op: ops)
+  for (const auto &op: ops)
   {
     if (op.conditional || op.old_conditional)
     {
@@ -454,7 +459,7 @@ void State::apply_ops_parallel(const std::vector<Operations::Op> &ops, RngEngine
 void State::apply_stabilizer_circuit(const std::vector<Operations::Op> &ops,
                                       ExperimentData &data, RngEngine &rng)
 {
-  for (const auto op: ops)
+  for (const auto &op: ops)
   {
     switch (op.type)
     {
@@ -576,13 +581,13 @@ void State::apply_gate(const Operations::Op &op, RngEngine &rng)
 
 void State::apply_gate(const Operations::Op &op, RngEngine &rng, uint_t rank)
 {
-  auto it = gateset_.find(op.name);
-  if (it == gateset_.end())
+  auto it = gate_table_.find(op);
+  if (it == nullptr)
   {
     throw std::invalid_argument("CH::State: Invalid gate operation \'"
                                 +op.name + "\'.");
   }
-  switch(it->second)
+  switch(*it)
   {
     case Gates::x:
       BaseState::qreg_.apply_x(op.qubits[0], rank);
@@ -744,7 +749,7 @@ inline void to_json(json_t &js, cvector_t vec)
 uint_t State::compute_chi(const std::vector<Operations::Op> &ops) const
 {
   double xi = 1;
-  for (const auto op: ops)
+  for (const auto &op: ops)
   {
     compute_extent(op, xi);
   }
@@ -756,13 +761,13 @@ void State::compute_extent(const Operations::Op &op, double &xi) const
 {
   if(op.type == Operations::OpType::gate)
   {
-    auto it = gateset_.find(op.name);
-    if (it == gateset_.end())
+    auto it = gate_table_.find(op);
+    if (it == nullptr)
     {
       throw std::invalid_argument("CH::State: Invalid gate operation \'"
                                   +op.name + "\'.");
     }
-    switch (it->second)
+    switch (*it)
     {
       case Gates::t:
         xi *= CHSimulator::t_extent;
@@ -274,6 +274,9 @@ protected:
   // Table of allowed gate names to gate enum class members
   const static stringmap_t<Gates> gateset_;
 
+  // Table of the gates of gateset_ indexed by gate identifier
+  const static Operations::GateTable<Gates> gate_table_;
+
   // Table of allowed snapshot types to enum class members
   const static stringmap_t<Snapshots> snapshotset_;
 
@@ -310,6 +313,8 @@ const stringmap_t<Gates> State::gateset_({
    {"ccx", Gates::mcx}    // Controlled-CX gate (Toffoli)
 });
 
+const Operations::GateTable<Gates> State::gate_table_(gateset_);
+
 const stringmap_t<Snapshots> State::snapshotset_({
   {"statevector", Snapshots::statevector},
   {"probabilities", Snapshots::probs},
@@ -405,7 +410,7 @@ void State::apply_ops(const std::vector<Operations::Op> &ops,
                       RngEngine &rng) {
 
   // Simple loop over vector of input operations
-  for (const auto op: ops) {
+  for (const auto &op: ops) {
     if(BaseState::creg_.check_conditional(op)) {
       switch (op.type) {
         case Operations::OpType::barrier:
@@ -541,12 +546,12 @@ void State::snapshot_probabilities(const Operations::Op &op,
 }
 
 void State::apply_gate(const Operations::Op &op) {
-  // Look for gate name in gateset
-  auto it = gateset_.find(op.name);
-  if (it == gateset_.end())
+  // Look up the gate of the op in the gate table
+  auto it = gate_table_.find(op);
+  if (it == nullptr)
     throw std::invalid_argument(
       "MatrixProductState::State::invalid gate instruction \'" + op.name + "\'.");
-  switch (it -> second) {
+  switch (*it) {
   case Gates::mcx:
       qreg_.apply_ccx(op.qubits);
       break;
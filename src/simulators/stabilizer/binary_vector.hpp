@@ -64,6 +64,13 @@ public:
 
   void makeZero() { m_data.assign((m_length - 1) / BLOCK_SIZE + 1, ZERO_); }
 
+  // Access the n-th block of BLOCK_SIZE bits of the vector
+  uint64_t &block(uint64_t n) { return m_data[n]; }
+  uint64_t block(uint64_t n) const { return m_data[n]; }
+
+  // Return the number of blocks of the vector
+  uint64_t numBlocks() const { return m_data.size(); }
+
   bool isZero() const;
 
   bool isSame(const BinaryVector &rhs) const;
@@ -0,0 +1,296 @@
+/**
+ * This code is part of Qiskit.
+ *
+ * (C) Copyright IBM 2018, 2019.
+ *
+ * This code is licensed under the Apache License, Version 2.0. You may
+ * obtain a copy of this license in the LICENSE.txt file in the root directory
+ * of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Any modifications or derivative works of this code must retain this
+ * copyright notice, and modified files need to carry a notice indicating
+ * that they have been altered from the originals.
+ */
+
+#ifndef _aer_stabilizer_pauli_frame_hpp
+#define _aer_stabilizer_pauli_frame_hpp
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "framework/operations.hpp"
+#include "framework/rng.hpp"
+#include "framework/types.hpp"
+#include "simulators/stabilizer/stabilizer_state.hpp"
+
+namespace AER {
+namespace Stabilizer {
+
+//============================================================================
+// Pauli frames of a batch of shots
+//============================================================================
+
+// The Pauli frame of a shot of a Clifford circuit with Pauli errors is the
+// Pauli operator by which its state differs from the state of a reference
+// shot of the ideal circuit. A measurement outcome of the shot is the
+// reference outcome flipped by the X part of its frame.
+//
+// The frames of each qubit are stored as a Pauli::Pauli whose X and Z bit
+// vectors are indexed by shot, so that a Clifford gate updates the frames
+// of 64 shots with a single word operation.
+
+class PauliFrame {
+
+public:
+
+  // Return the outcome of each qubit of each measure op of a reference
+  // shot of the ideal circuit starting from the all |0> state. Ops that
+  // are not measurements have an empty outcome.
+  static std::vector<reg_t> reference_sample(
+      const std::vector<Operations::Op> &ops, uint_t num_qubits,
+      RngEngine &rng);
+
+  // Return true if the frames can be updated by the named gate
+  static bool allowed_gate(const std::string &name) {
+    return gateset_.find(name) != gateset_.end();
+  }
+
+  // Initialize the frames of num_shots shots of the all |0> state
+  void initialize(uint_t num_qubits, uint_t num_shots, RngEngine &rng);
+
+  // Return the number of qubits
+  uint_t num_qubits() const {return frames_.size();}
+
+  // Return the number of shots
+  uint_t num_shots() const {return num_shots_;}
+
+  // Apply a Clifford gate to the frames of every shot
+  void apply_gate(const Operations::Op &op);
+
+  // Apply a named Pauli gate to the frame of a single shot
+  void apply_pauli(const std::string &name, uint_t qubit, uint_t shot);
+
+  // Set flips to the shots whose Z measurement outcome of a qubit differs
+  // from the reference outcome
+  void apply_measure(uint_t qubit, BV::BinaryVector &flips, RngEngine &rng);
+
+  // Reset a qubit to the |0> state in every shot
+  void apply_reset(uint_t qubit, RngEngine &rng);
+
+protected:
+
+  // Multiply the frames of a qubit by a Z with probability 1/2 for each
+  // shot. This doesn't change the state of a qubit stabilized by Z, but
+  // randomizes the outcome of a later measurement that is random in the
+  // ideal circuit.
+  void randomize_z(uint_t qubit, RngEngine &rng);
+
+  // Frames of each qubit, indexed by shot
+  std::vector<Pauli::Pauli> frames_;
+
+  uint_t num_shots_ = 0;
+
+  // Table of allowed gate names to gate enum class members
+  const static stringmap_t<Gates> gateset_;
+
+  // Table of the gates of gateset_ indexed by gate identifier
+  const static Operations::GateTable<Gates> gate_table_;
+};
+
+//============================================================================
+// Implementation
+//============================================================================
+
+const stringmap_t<Gates> PauliFrame::gateset_({
+  // Single qubit gates
+  {"id", Gates::id},    // Pauli-Identity gate
+  {"x", Gates::x},      // Pauli-X gate
+  {"y", Gates::y},      // Pauli-Y gate
+  {"z", Gates::z},      // Pauli-Z gate
+  {"s", Gates::s},      // Phase gate (aka sqrt(Z) gate)
+  {"sdg", Gates::sdg},  // Conjugate-transpose of Phase gate
+  {"h", Gates::h},      // Hadamard gate (X + Z / sqrt(2))
+  // Two-qubit gates
+  {"CX", Gates::cx},    // Controlled-X gate (CNOT)
+  {"cx", Gates::cx},    // Controlled-X gate (CNOT),
+  {"cz", Gates::cz},    // Controlled-Z gate
+  {"swap", Gates::swap} // SWAP gate
+});
+
+const Operations::GateTable<Gates> PauliFrame::gate_table_(gateset_);
+
+std::vector<reg_t> PauliFrame::reference_sample(
+    const std::vector<Operations::Op> &ops, uint_t num_qubits,
+    RngEngine &rng) {
+  const rvector_t dist = {0.5, 0.5};
+  Clifford::Clifford qreg(num_qubits);
+  std::vector<reg_t> outcomes(ops.size());
+  for (size_t pos = 0; pos < ops.size(); ++pos) {
+    const auto &op = ops[pos];
+    switch (op.type) {
+      case Operations::OpType::gate: {
+        auto it = gate_table_.find(op);
+        if (it == nullptr)
+          throw std::invalid_argument(
+              "PauliFrame::invalid gate instruction \'" + op.name + "\'.");
+        switch (*it) {
+          case Gates::id:
+            break;
+          case Gates::x:
+            qreg.append_x(op.qubits[0]);
+            break;
+          case Gates::y:
+            qreg.append_y(op.qubits[0]);
+            break;
+          case Gates::z:
+            qreg.append_z(op.qubits[0]);
+            break;
+          case Gates::h:
+            qreg.append_h(op.qubits[0]);
+            break;
+          case Gates::s:
+            qreg.append_s(op.qubits[0]);
+            break;
+          case Gates::sdg:
+            qreg.append_z(op.qubits[0]);
+            qreg.append_s(op.qubits[0]);
+            break;
+          case Gates::cx:
+            qreg.append_cx(op.qubits[0], op.qubits[1]);
+            break;
+          case Gates::cz:
+            qreg.append_h(op.qubits[1]);
+            qreg.append_cx(op.qubits[0], op.qubits[1]);
+            qreg.append_h(op.qubits[1]);
+            break;
+          case Gates::swap:
+            qreg.append_cx(op.qubits[0], op.qubits[1]);
+            qreg.append_cx(op.qubits[1], op.qubits[0]);
+            qreg.append_cx(op.qubits[0], op.qubits[1]);
+            break;
+        }
+        break;
+      }
+      case Operations::OpType::measure:
+        for (const auto qubit : op.qubits)
+          outcomes[pos].push_back(
+              qreg.measure_and_update(qubit, rng.rand_int(dist)));
+        break;
+      case Operations::OpType::reset:
+        for (const auto qubit : op.qubits) {
+          if (qreg.measure_and_update(qubit, rng.rand_int(dist)))
+            qreg.append_x(qubit);
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  return outcomes;
+}
+
+void PauliFrame::initialize(uint_t num_qubits, uint_t num_shots,
+                            RngEngine &rng) {
+  num_shots_ = num_shots;
+  frames_.assign(num_qubits, Pauli::Pauli(num_shots));
+  for (uint_t qubit = 0; qubit < num_qubits; ++qubit)
+    randomize_z(qubit, rng);
+}
+
+void PauliFrame::randomize_z(uint_t qubit, RngEngine &rng) {
+  auto &z = frames_[qubit].Z;
+  const auto max = std::numeric_limits<uint_t>::max();
+  for (uint64_t n = 0; n < z.numBlocks(); ++n)
+    z.block(n) ^= rng.rand_int(uint_t(0), max);
+}
+
+void PauliFrame::apply_gate(const Operations::Op &op) {
+  auto it = gate_table_.find(op);
+  if (it == nullptr)
+    throw std::invalid_argument(
+        "PauliFrame::invalid gate instruction \'" + op.name + "\'.");
+  switch (*it) {
+    case Gates::id:
+    case Gates::x:
+    case Gates::y:
+    case Gates::z:
+      // Pauli gates only change the phase of a frame
+      break;
+    case Gates::h: {
+      auto &frame = frames_[op.qubits[0]];
+      frame.X.swap(frame.Z);
+      break;
+    }
+    case Gates::s:
+    case Gates::sdg: {
+      auto &frame = frames_[op.qubits[0]];
+      frame.Z += frame.X;
+      break;
+    }
+    case Gates::cx: {
+      auto &ctrl = frames_[op.qubits[0]];
+      auto &trgt = frames_[op.qubits[1]];
+      trgt.X += ctrl.X;
+      ctrl.Z += trgt.Z;
+      break;
+    }
+    case Gates::cz: {
+      auto &frame0 = frames_[op.qubits[0]];
+      auto &frame1 = frames_[op.qubits[1]];
+      frame0.Z += frame1.X;
+      frame1.Z += frame0.X;
+      break;
+    }
+    case Gates::swap:
+      std::swap(frames_[op.qubits[0]], frames_[op.qubits[1]]);
+      break;
+  }
+}
+
+void PauliFrame::apply_pauli(const std::string &name, uint_t qubit,
+                             uint_t shot) {
+  auto it = gateset_.find(name);
+  if (it == gateset_.end())
+    throw std::invalid_argument(
+        "PauliFrame::invalid Pauli instruction \'" + name + "\'.");
+  switch (it->second) {
+    case Gates::id:
+      break;
+    case Gates::x:
+      frames_[qubit].X.flipAt(shot);
+      break;
+    case Gates::y:
+      frames_[qubit].X.flipAt(shot);
+      frames_[qubit].Z.flipAt(shot);
+      break;
+    case Gates::z:
+      frames_[qubit].Z.flipAt(shot);
+      break;
+    default:
+      throw std::invalid_argument(
+          "PauliFrame::invalid Pauli instruction \'" + name + "\'.");
+  }
+}
+
+void PauliFrame::apply_measure(uint_t qubit, BV::BinaryVector &flips,
+                               RngEngine &rng) {
+  flips = frames_[qubit].X;
+  // The post-measurement state is stabilized by Z
+  randomize_z(qubit, rng);
+}
+
+void PauliFrame::apply_reset(uint_t qubit, RngEngine &rng) {
+  frames_[qubit].X.makeZero();
+  frames_[qubit].Z.makeZero();
+  randomize_z(qubit, rng);
+}
+
+//------------------------------------------------------------------------------
+} // end namespace Stabilizer
+//------------------------------------------------------------------------------
+} // end namespace AER
+//------------------------------------------------------------------------------
+#endif
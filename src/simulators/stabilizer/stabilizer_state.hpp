@@ -190,6 +190,9 @@ protected:
   // Table of allowed gate names to gate enum class members
   const static stringmap_t<Gates> gateset_;
 
+  // Table of the gates of gateset_ indexed by gate identifier
+  const static Operations::GateTable<Gates> gate_table_;
+
   // Table of allowed snapshot types to enum class members
   const static stringmap_t<Snapshots> snapshotset_;
 
@@ -216,6 +219,8 @@ const stringmap_t<Gates> State::gateset_({
   {"swap", Gates::swap} // SWAP gate
 });
 
+const Operations::GateTable<Gates> State::gate_table_(gateset_);
+
 const stringmap_t<Snapshots> State::snapshotset_({
   {"stabilizer", Snapshots::stabilizer},
   {"memory", Snapshots::cmemory},
@@ -285,7 +290,7 @@ void State::apply_ops(const std::vector<Operations::Op> &ops,
                       ExperimentData &data,
                       RngEngine &rng) {
   // Simple loop over vector of input operations
-  for (const auto op: ops) {
+  for (const auto &op: ops) {
     if(BaseState::creg_.check_conditional(op)) {
       switch (op.type) {
         case Operations::OpType::barrier:
@@ -318,11 +323,11 @@ void State::apply_ops(const std::vector<Operations::Op> &ops,
 
 void State::apply_gate(const Operations::Op &op) {
   // Check Op is supported by State
-  auto it = gateset_.find(op.name);
-  if (it == gateset_.end())
+  auto it = gate_table_.find(op);
+  if (it == nullptr)
     throw std::invalid_argument("Stabilizer::State::invalid gate instruction \'" +
                                 op.name + "\'.");
-  switch (it -> second) {
+  switch (*it) {
     case Gates::id:
       break;
     case Gates::x:
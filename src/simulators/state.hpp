@@ -105,6 +105,19 @@ public:
   // Load any settings for the State class from a config JSON
   virtual void set_config(const json_t &config);
 
+  //-----------------------------------------------------------------------
+  // Optional: apply a range of operations
+  //-----------------------------------------------------------------------
+
+  // Apply the contiguous sequence of operations [first, last) without
+  // copying them into a vector. This allows the ops of a circuit to be
+  // interleaved with ops from a different buffer, such as sampled noise.
+  // The default implementation copies the range and calls apply_ops.
+  virtual void apply_ops_range(const Operations::Op *first,
+                               const Operations::Op *last,
+                               ExperimentData &data,
+                               RngEngine &rng);
+
   //-----------------------------------------------------------------------
   // Optional: measurement sampling
   //
@@ -159,6 +172,10 @@ public:
                        const std::string &memory_hex,
                        const std::string &register_hex);
 
+  // Initialize classical memory and register to the values of another
+  // classical register
+  void initialize_creg(const ClassicalRegister &creg);
+
   // Add current creg classical bit values to a ExperimentData container
   void add_creg_to_data(ExperimentData &data) const;
 
@@ -191,7 +208,8 @@ public:
   // Data accessors
   //-----------------------------------------------------------------------
 
-  // Returns a const reference to the states data structure
+  // Returns a reference to the states data structure
+  inline state_t &qreg() {return qreg_;}
   inline const state_t &qreg() const {return qreg_;}
   inline const auto &creg() const {return creg_;}
 
@@ -219,6 +237,15 @@ void State<state_t>::set_config(const json_t &config) {
 }
 
 
+template <class state_t>
+void State<state_t>::apply_ops_range(const Operations::Op *first,
+                                     const Operations::Op *last,
+                                     ExperimentData &data,
+                                     RngEngine &rng) {
+  apply_ops(std::vector<Operations::Op>(first, last), data, rng);
+}
+
+
 template <class state_t>
 std::vector<reg_t> State<state_t>::sample_measure(const reg_t &qubits,
                                                   uint_t shots,
@@ -277,6 +304,12 @@ void State<state_t>::initialize_creg(uint_t num_memory,
 }
 
 
+template <class state_t>
+void State<state_t>::initialize_creg(const ClassicalRegister &creg) {
+  creg_ = creg;
+}
+
+
 template <class state_t>
 void State<state_t>::snapshot_state(const Operations::Op &op,
                                     ExperimentData &data,
@@ -309,14 +342,15 @@ void State<state_t>::snapshot_creg_register(const Operations::Op &op,
 template <class state_t>
 void State<state_t>::add_creg_to_data(ExperimentData &data) const {
   if (creg_.memory_size() > 0) {
-    std::string memory_hex = creg_.memory_hex();
-    data.add_memory_count(memory_hex);
-    data. add_pershot_memory(memory_hex);
+    const reg_t &memory = creg_.memory_words();
+    data.add_memory_count(memory, creg_.memory_size());
+    data.add_pershot_memory(memory, creg_.memory_size());
   }
   // Register bits value
   if (creg_.register_size() > 0) {
     data. add_pershot_register(creg_.register_hex());
   }
+  data.end_shot();
 }
 //-------------------------------------------------------------------------
 } // end namespace Base
@@ -0,0 +1,246 @@
+/**
+ * This code is part of Qiskit.
+ *
+ * (C) Copyright IBM 2018, 2019.
+ *
+ * This code is licensed under the Apache License, Version 2.0. You may
+ * obtain a copy of this license in the LICENSE.txt file in the root directory
+ * of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Any modifications or derivative works of this code must retain this
+ * copyright notice, and modified files need to carry a notice indicating
+ * that they have been altered from the originals.
+ */
+
+#ifndef _qv_batched_qubit_vector_hpp_
+#define _qv_batched_qubit_vector_hpp_
+
+#include <algorithm>
+#include <complex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "simulators/statevector/qubitvector.hpp"
+
+namespace QV {
+
+//============================================================================
+// BatchedQubitVector class
+//============================================================================
+
+// A batch of independent qubit vectors of the same number of qubits.
+// Each vector in the batch is called a lane. The data is stored with the
+// amplitude index major and the lane index minor, so that element i of
+// lane l is stored at position i * num_lanes + l. This allows a gate to be
+// applied to every lane with a single kernel whose inner loop over the
+// lanes is contiguous and vectorizes.
+//
+// Updates that differ between lanes are done by copying a single lane to
+// a QubitVector, updating it, and copying the lane back.
+
+template <typename data_t = double>
+class BatchedQubitVector {
+
+public:
+
+  //-----------------------------------------------------------------------
+  // Utility functions
+  //-----------------------------------------------------------------------
+
+  // Initialize every lane to the same num_qubit state
+  void initialize(size_t num_qubits, size_t num_lanes,
+                  const std::complex<data_t> *state);
+
+  // Returns the number of qubits of each lane
+  uint_t num_qubits() const {return num_qubits_;}
+
+  // Returns the number of lanes
+  uint_t num_lanes() const {return num_lanes_;}
+
+  // Copy the state of a single lane to data
+  void get_lane(uint_t lane, std::complex<data_t> *data) const;
+
+  // Set the state of a single lane from data
+  void set_lane(uint_t lane, const std::complex<data_t> *data);
+
+  //-----------------------------------------------------------------------
+  // Apply matrices
+  //-----------------------------------------------------------------------
+
+  // Apply a N-qubit matrix to every lane.
+  // The matrix is input as vector of the column-major vectorized N-qubit
+  // matrix.
+  void apply_matrix(const reg_t &qubits, const cvector_t<double> &mat);
+
+  // Apply a N-qubit matrix to a single lane.
+  // The matrix is input as vector of the column-major vectorized N-qubit
+  // matrix.
+  void apply_lane_matrix(uint_t lane, const reg_t &qubits,
+                         const cvector_t<double> &mat);
+
+protected:
+
+  // Check that the qubits are valid for the current number of qubits
+  void check_qubits(const reg_t &qubits) const;
+
+  size_t num_qubits_ = 0;
+  size_t num_lanes_ = 0;
+  std::vector<std::complex<data_t>> data_;
+
+  // Buffer for the lanes of the input amplitudes of apply_matrix
+  std::vector<std::complex<data_t>> cache_;
+
+  // Set inds to the indexes of the k-th group of amplitudes of a N-qubit
+  // matrix
+  void group_indexes(uint_t k, const reg_t &qubits, const reg_t &qubits_sorted,
+                     std::vector<uint_t> &inds) const;
+};
+
+//============================================================================
+// Implementations
+//============================================================================
+
+template <typename data_t>
+void BatchedQubitVector<data_t>::initialize(size_t num_qubits,
+                                            size_t num_lanes,
+                                            const std::complex<data_t> *state) {
+  num_qubits_ = num_qubits;
+  num_lanes_ = num_lanes;
+  const uint_t dim = BITS[num_qubits];
+  data_.resize(dim * num_lanes);
+  for (uint_t i = 0; i < dim; i++)
+    std::fill(data_.begin() + i * num_lanes,
+              data_.begin() + (i + 1) * num_lanes, state[i]);
+}
+
+template <typename data_t>
+void BatchedQubitVector<data_t>::get_lane(uint_t lane,
+                                          std::complex<data_t> *data) const {
+  const uint_t dim = BITS[num_qubits_];
+  for (uint_t i = 0; i < dim; i++)
+    data[i] = data_[i * num_lanes_ + lane];
+}
+
+template <typename data_t>
+void BatchedQubitVector<data_t>::set_lane(uint_t lane,
+                                          const std::complex<data_t> *data) {
+  const uint_t dim = BITS[num_qubits_];
+  for (uint_t i = 0; i < dim; i++)
+    data_[i * num_lanes_ + lane] = data[i];
+}
+
+template <typename data_t>
+void BatchedQubitVector<data_t>::check_qubits(const reg_t &qubits) const {
+  for (const auto &qubit : qubits) {
+    if (qubit + 1 > num_qubits_) {
+      throw std::runtime_error(
+          "BatchedQubitVector: qubit index " + std::to_string(qubit) +
+          " > " + std::to_string(num_qubits_));
+    }
+  }
+}
+
+template <typename data_t>
+void BatchedQubitVector<data_t>::group_indexes(uint_t k, const reg_t &qubits,
+                                               const reg_t &qubits_sorted,
+                                               std::vector<uint_t> &inds) const {
+  uint_t lowbits, index0 = k;
+  for (const auto &qubit : qubits_sorted) {
+    lowbits = index0 & MASKS[qubit];
+    index0 >>= qubit;
+    index0 <<= qubit + 1;
+    index0 |= lowbits;
+  }
+  inds[0] = index0;
+  for (uint_t i = 0; i < qubits.size(); i++) {
+    const auto n = BITS[i];
+    const auto bit = BITS[qubits[i]];
+    for (uint_t j = 0; j < n; j++)
+      inds[n + j] = inds[j] | bit;
+  }
+}
+
+template <typename data_t>
+void BatchedQubitVector<data_t>::apply_matrix(const reg_t &qubits,
+                                              const cvector_t<double> &mat) {
+  check_qubits(qubits);
+  const uint_t N = qubits.size();
+  const uint_t DIM = BITS[N];
+  if (mat.size() != DIM * DIM) {
+    throw std::runtime_error(
+        "BatchedQubitVector::apply_matrix: matrix is wrong size.");
+  }
+  auto qubits_sorted = qubits;
+  std::sort(qubits_sorted.begin(), qubits_sorted.end());
+
+  const uint_t lanes = num_lanes_;
+  cache_.resize(DIM * lanes);
+  std::vector<uint_t> inds(DIM);
+  // Complex amplitudes are updated through their real and imaginary parts
+  // so that the loop over lanes vectorizes
+  data_t *data = reinterpret_cast<data_t *>(data_.data());
+  const data_t *cache = reinterpret_cast<const data_t *>(cache_.data());
+
+  const uint_t END = BITS[num_qubits_] >> N;
+  for (uint_t k = 0; k < END; k++) {
+    group_indexes(k, qubits, qubits_sorted, inds);
+    // Cache the input lanes and compute the output lanes
+    for (uint_t i = 0; i < DIM; i++) {
+      std::copy(data_.begin() + inds[i] * lanes,
+                data_.begin() + (inds[i] + 1) * lanes,
+                cache_.begin() + i * lanes);
+    }
+    for (uint_t i = 0; i < DIM; i++) {
+      data_t *out = data + 2 * inds[i] * lanes;
+      std::fill(out, out + 2 * lanes, 0.);
+      for (uint_t j = 0; j < DIM; j++) {
+        if (mat[i + DIM * j] == std::complex<double>(0., 0.))
+          continue;
+        const data_t re = std::real(mat[i + DIM * j]);
+        const data_t im = std::imag(mat[i + DIM * j]);
+        const data_t *in = cache + 2 * j * lanes;
+        #pragma omp simd
+        for (uint_t l = 0; l < lanes; l++) {
+          out[2 * l] += re * in[2 * l] - im * in[2 * l + 1];
+          out[2 * l + 1] += re * in[2 * l + 1] + im * in[2 * l];
+        }
+      }
+    }
+  }
+}
+
+template <typename data_t>
+void BatchedQubitVector<data_t>::apply_lane_matrix(uint_t lane,
+                                                   const reg_t &qubits,
+                                                   const cvector_t<double> &mat) {
+  check_qubits(qubits);
+  const uint_t N = qubits.size();
+  const uint_t DIM = BITS[N];
+  if (mat.size() != DIM * DIM) {
+    throw std::runtime_error(
+        "BatchedQubitVector::apply_lane_matrix: matrix is wrong size.");
+  }
+  auto qubits_sorted = qubits;
+  std::sort(qubits_sorted.begin(), qubits_sorted.end());
+
+  std::vector<uint_t> inds(DIM);
+  std::vector<std::complex<data_t>> cache(DIM);
+  const uint_t END = BITS[num_qubits_] >> N;
+  for (uint_t k = 0; k < END; k++) {
+    group_indexes(k, qubits, qubits_sorted, inds);
+    for (uint_t i = 0; i < DIM; i++)
+      cache[i] = data_[inds[i] * num_lanes_ + lane];
+    for (uint_t i = 0; i < DIM; i++) {
+      std::complex<data_t> out = 0.;
+      for (uint_t j = 0; j < DIM; j++)
+        out += std::complex<data_t>(mat[i + DIM * j]) * cache[j];
+      data_[inds[i] * num_lanes_ + lane] = out;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+} // end namespace QV
+//------------------------------------------------------------------------------
+#endif // end module
@@ -160,6 +160,10 @@ public:
   // Returns a copy of the underlying data_t data as a complex vector
   cvector_t<data_t> vector() const;
 
+  // Returns the underlying data_t data as a complex vector and releases the
+  // memory of the qubit vector, which is left as a 0-qubit vector
+  cvector_t<data_t> move_to_vector();
+
   // Return JSON serialization of QubitVector;
   json_t json() const;
 
@@ -683,6 +687,16 @@ cvector_t<data_t> QubitVector<data_t>::vector() const {
   return ret;
 }
 
+template <typename data_t>
+cvector_t<data_t> QubitVector<data_t>::move_to_vector() {
+  // The data is allocated with malloc so it can't be adopted by the vector.
+  // It is copied in a single pass without zero initializing the vector, and
+  // freed straight away so that only one copy is kept in the result.
+  cvector_t<data_t> ret(data_, data_ + data_size_);
+  set_num_qubits(0);
+  return ret;
+}
+
 //------------------------------------------------------------------------------
 // Indexing
 //------------------------------------------------------------------------------
@@ -885,6 +885,10 @@ public:
   // Returns a copy of the underlying data_t data as a complex vector
   cvector_t<data_t> vector() const;
 
+  // Returns the underlying data_t data as a complex vector. The device
+  // memory is copied to the host, so this is the same as vector()
+  cvector_t<data_t> move_to_vector() {return vector();}
+
   // Return JSON serialization of QubitVectorThrust;
   json_t json() const;
 
@@ -81,7 +81,8 @@ public:
       Operations::OpType::roerror,
       Operations::OpType::matrix,
       Operations::OpType::multiplexer,
-      Operations::OpType::kraus
+      Operations::OpType::kraus,
+      Operations::OpType::thermal_relaxation
     });
   }
 
@@ -111,6 +112,12 @@ public:
                          ExperimentData &data,
                          RngEngine &rng) override;
 
+  // Apply the sequence of operations [first, last) by looping over it
+  virtual void apply_ops_range(const Operations::Op *first,
+                               const Operations::Op *last,
+                               ExperimentData &data,
+                               RngEngine &rng) override;
+
   // Initializes an n-qubit state to the all |0> state
   virtual void initialize_qreg(uint_t num_qubits) override;
 
@@ -197,6 +204,9 @@ protected:
                    const std::vector<cmatrix_t> &krausops,
                    RngEngine &rng);
 
+  // Apply a sampled trajectory of a thermal relaxation error operation
+  void apply_thermal_relaxation(const Operations::Op &op, RngEngine &rng);
+
   //-----------------------------------------------------------------------
   // Measurement Helpers
   //-----------------------------------------------------------------------
@@ -288,6 +298,9 @@ protected:
   // Table of allowed gate names to gate enum class members
   const static stringmap_t<Gates> gateset_;
 
+  // Table of the gates of gateset_ indexed by gate identifier
+  const static Operations::GateTable<Gates> gate_table_;
+
   // Table of allowed snapshot types to enum class members
   const static stringmap_t<Snapshots> snapshotset_;
 
@@ -336,6 +349,9 @@ const stringmap_t<Gates> State<statevec_t>::gateset_({
 
 });
 
+template <class statevec_t>
+const Operations::GateTable<Gates> State<statevec_t>::gate_table_(gateset_);
+
 
 template <class statevec_t>
 const stringmap_t<Snapshots> State<statevec_t>::snapshotset_({
@@ -438,9 +454,18 @@ template <class statevec_t>
 void State<statevec_t>::apply_ops(const std::vector<Operations::Op> &ops,
                                  ExperimentData &data,
                                  RngEngine &rng) {
+  apply_ops_range(ops.data(), ops.data() + ops.size(), data, rng);
+}
 
-  // Simple loop over vector of input operations
-  for (const auto & op: ops) {
+template <class statevec_t>
+void State<statevec_t>::apply_ops_range(const Operations::Op *first,
+                                        const Operations::Op *last,
+                                        ExperimentData &data,
+                                        RngEngine &rng) {
+
+  // Simple loop over range of input operations
+  for (auto it = first; it != last; ++it) {
+    const auto &op = *it;
     if(BaseState::creg_.check_conditional(op)) {
       switch (op.type) {
         case Operations::OpType::barrier:
@@ -475,6 +500,9 @@ void State<statevec_t>::apply_ops(const std::vector<Operations::Op> &ops,
         case Operations::OpType::kraus:
           apply_kraus(op.qubits, op.mats, rng);
           break;
+        case Operations::OpType::thermal_relaxation:
+          apply_thermal_relaxation(op, rng);
+          break;
         default:
           throw std::invalid_argument("QubitVector::State::invalid instruction \'" +
                                       op.name + "\'.");
@@ -691,12 +719,12 @@ void State<statevec_t>::snapshot_matrix_expval(const Operations::Op &op,
 
 template <class statevec_t>
 void State<statevec_t>::apply_gate(const Operations::Op &op) {
-  // Look for gate name in gateset
-  auto it = gateset_.find(op.name);
-  if (it == gateset_.end())
+  // Look up the gate of the op in the gate table
+  auto it = gate_table_.find(op);
+  if (it == nullptr)
     throw std::invalid_argument("QubitVectorState::invalid gate instruction \'" + 
                                 op.name + "\'.");
-  switch (it -> second) {
+  switch (*it) {
     case Gates::mcx:
       // Includes X, CX, CCX, etc
       BaseState::qreg_.apply_mcx(op.qubits);
@@ -1002,6 +1030,46 @@ void State<statevec_t>::apply_kraus(const reg_t &qubits,
   }
 }
 
+//=========================================================================
+// Implementation: Thermal relaxation noise
+//=========================================================================
+
+// The channel is sampled as pure dephasing followed by generalized
+// amplitude damping, whose product has the coherence factor of the
+// channel since the damping scales coherences by sqrt(1 - p_reset).
+// Relaxing to |0> (or |1> with the excited state population) is a
+// jump from the other state with probability p_reset times its population,
+// and otherwise the population of the other state is damped.
+template <class statevec_t>
+void State<statevec_t>::apply_thermal_relaxation(const Operations::Op &op,
+                                                 RngEngine &rng) {
+  const auto channel = Operations::thermal_relaxation_channel(op);
+  const reg_t &qubits = op.qubits;
+
+  // Dephasing
+  const double keep = 1. - channel.p_reset;
+  const double dephasing = (keep > 0.) ? channel.coherence / std::sqrt(keep) : 1.;
+  if (rng.rand(0., 1.) < 0.5 * (1. - dephasing))
+    BaseState::qreg_.apply_mcphase(qubits, -1);
+
+  // Amplitude damping
+  if (channel.p_reset <= 0.)
+    return;
+  const uint_t target = (rng.rand(0., 1.) < channel.p_excited) ? 1 : 0;
+  const uint_t other = 1 - target;
+  const double p_other = measure_probs(qubits)[other];
+  const double p_jump = channel.p_reset * p_other;
+  if (rng.rand(0., 1.) < p_jump) {
+    measure_reset_update(qubits, target, other, p_other);
+  } else {
+    // Damp and renormalize the population of the other state
+    cvector_t mdiag(2, 0.);
+    mdiag[target] = 1. / std::sqrt(1. - p_jump);
+    mdiag[other] = std::sqrt(keep) * mdiag[target];
+    apply_matrix(qubits, mdiag);
+  }
+}
+
 //-------------------------------------------------------------------------
 } // end namespace QubitVector
 //-------------------------------------------------------------------------
@@ -66,7 +66,8 @@ public:
       Operations::OpType::barrier,
       Operations::OpType::matrix,
       Operations::OpType::kraus,
-      Operations::OpType::superop
+      Operations::OpType::superop,
+      Operations::OpType::thermal_relaxation
     });
   }
 
@@ -177,6 +178,9 @@ protected:
 
   // Table of allowed gate names to gate enum class members
   const static stringmap_t<Gates> gateset_;
+
+  // Table of the gates of gateset_ indexed by gate identifier
+  const static Operations::GateTable<Gates> gate_table_;
 };
 
 
@@ -210,6 +214,9 @@ const stringmap_t<Gates> State<data_t>::gateset_({
   {"ccx", Gates::ccx}    // Controlled-CX gate (Toffoli)
 });
 
+template <class data_t>
+const Operations::GateTable<Gates> State<data_t>::gate_table_(gateset_);
+
 //============================================================================
 // Implementation: Base class method overrides
 //============================================================================
@@ -219,7 +226,7 @@ void State<data_t>::apply_ops(const std::vector<Operations::Op> &ops,
                                   ExperimentData &data,
                                   RngEngine &rng) {
   // Simple loop over vector of input operations
-  for (const auto op: ops) {
+  for (const auto &op: ops) {
     switch (op.type) {
       case Operations::OpType::barrier:
         break;
@@ -240,6 +247,12 @@ void State<data_t>::apply_ops(const std::vector<Operations::Op> &ops,
       case Operations::OpType::superop:
         BaseState::qreg_.apply_superop_matrix(op.qubits, Utils::vectorize_matrix(op.mats[0]));
         break;
+      case Operations::OpType::thermal_relaxation: {
+        const auto channel = Operations::thermal_relaxation_channel(op);
+        BaseState::qreg_.apply_thermal_relaxation(op.qubits[0], channel.p_reset,
+                                                  channel.p_excited, channel.coherence);
+        break;
+      }
       case Operations::OpType::snapshot:
         apply_snapshot(op, data);
         break;
@@ -355,12 +368,12 @@ void State<statevec_t>::apply_kraus(const reg_t &qubits,
 
 template <class data_t>
 void State<data_t>::apply_gate(const Operations::Op &op) {
-  // Look for gate name in gateset
-  auto it = gateset_.find(op.name);
-  if (it == gateset_.end())
+  // Look up the gate of the op in the gate table
+  auto it = gate_table_.find(op);
+  if (it == nullptr)
     throw std::invalid_argument("Unitary::State::invalid gate instruction \'" +
                                 op.name + "\'.");
-  switch (it -> second) {
+  switch (*it) {
     case Gates::u3:
       apply_gate_u3(op.qubits[0],
                     std::real(op.params[0]),
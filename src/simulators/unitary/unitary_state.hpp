@@ -167,6 +167,9 @@ class State : public Base::State<unitary_matrix_t> {
 
   // Table of allowed gate names to gate enum class members
   const static stringmap_t<Gates> gateset_;
+
+  // Table of the gates of gateset_ indexed by gate identifier
+  const static Operations::GateTable<Gates> gate_table_;
 };
 
 //============================================================================
@@ -210,6 +213,9 @@ const stringmap_t<Gates> State<unitary_matrix_t>::gateset_({
     {"mcswap", Gates::mcswap}  // Multi-controlled-SWAP gate
 });
 
+template <class unitary_matrix_t>
+const Operations::GateTable<Gates> State<unitary_matrix_t>::gate_table_(gateset_);
+
 //============================================================================
 // Implementation: Base class method overrides
 //============================================================================
@@ -219,7 +225,7 @@ void State<unitary_matrix_t>::apply_ops(
     const std::vector<Operations::Op> &ops, ExperimentData &data,
     RngEngine &rng) {
   // Simple loop over vector of input operations
-  for (const auto op : ops) {
+  for (const auto &op : ops) {
     switch (op.type) {
       case Operations::OpType::barrier:
         break;
@@ -311,12 +317,12 @@ void State<unitary_matrix_t>::initialize_omp() {
 
 template <class unitary_matrix_t>
 void State<unitary_matrix_t>::apply_gate(const Operations::Op &op) {
-  // Look for gate name in gateset
-  auto it = gateset_.find(op.name);
-  if (it == gateset_.end())
+  // Look up the gate of the op in the gate table
+  auto it = gate_table_.find(op);
+  if (it == nullptr)
     throw std::invalid_argument("Unitary::State::invalid gate instruction \'" +
                                 op.name + "\'.");
-  Gates g = it->second;
+  Gates g = *it;
   switch (g) {
     case Gates::mcx:
       // Includes X, CX, CCX, etc
@@ -63,6 +63,10 @@ public:
   // Returns a copy of the underlying data_t data as a complex vector
   AER::cmatrix_t matrix() const;
 
+  // Returns the underlying data_t data as a complex matrix and releases the
+  // memory of the unitary, which is left as a 0-qubit unitary
+  AER::cmatrix_t move_to_matrix();
+
   // Return the trace of the unitary
   std::complex<double> trace() const;
 
@@ -204,6 +208,17 @@ AER::cmatrix_t UnitaryMatrix<data_t>::matrix() const {
   return ret;
 }
 
+template <class data_t>
+AER::cmatrix_t UnitaryMatrix<data_t>::move_to_matrix() {
+  // The data is already stored in column-major order so it is copied in a
+  // single pass and freed straight away
+  AER::cmatrix_t ret(rows_, rows_);
+  std::copy(BaseVector::data_, BaseVector::data_ + BaseVector::data_size_,
+            ret.GetMat());
+  set_num_qubits(0);
+  return ret;
+}
+
 //------------------------------------------------------------------------------
 // Utility
 //------------------------------------------------------------------------------
@@ -70,6 +70,10 @@ public:
   // Returns a copy of the underlying data_t data as a complex vector
   AER::cmatrix_t matrix() const;
 
+  // Returns the underlying data_t data as a complex matrix. The device
+  // memory is copied to the host, so this is the same as matrix()
+  AER::cmatrix_t move_to_matrix() {return matrix();}
+
   // Return the trace of the unitary
   std::complex<double> trace() const;
 
@@ -247,6 +247,7 @@ bool Fusion::can_apply_fusion(const op_t& op) const {
   case optype_t::roerror:
   case optype_t::snapshot:
   case optype_t::kraus:
+  case optype_t::thermal_relaxation:
   case optype_t::barrier:
   default:
     return false;
@@ -0,0 +1,61 @@
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2018, 2019, 2020.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+
+"""Noisy shots benchmark suite"""
+# Write the benchmarking functions here.
+# See "Writing benchmarks" in the asv docs for more information.
+
+from qiskit import QiskitError
+from qiskit.compiler import transpile, assemble
+from qiskit.providers.aer import QasmSimulator
+from .tools import quantum_volume_circuit, mixed_unitary_noise_model, \
+                   kraus_noise_model
+
+
+class NoisyShotsTimeSuite:
+    """
+    Benchmarking times for noisy shots of Quantum Volume circuits executed
+    one at a time or in batches with the statevector method.
+
+    Sparse noise sampling is disabled so that every shot samples its noise
+    while it is executed.
+    """
+
+    def __init__(self):
+        self.timeout = 60 * 20
+        self.qv_circuits = []
+        self.backend = QasmSimulator()
+        for num_qubits in (5, 10):
+            circ = quantum_volume_circuit(num_qubits, 10, seed=1)
+            circ = transpile(circ, basis_gates=['u1', 'u2', 'u3', 'cx'],
+                             optimization_level=0, seed_transpiler=1)
+            qobj = assemble(circ, self.backend, shots=1000)
+            self.qv_circuits.append(qobj)
+        self.param_names = ["Quantum Volume", "Noise Model", "Batched Shots"]
+        self.params = (self.qv_circuits, [
+            mixed_unitary_noise_model(),
+            kraus_noise_model()
+        ], [1, 64])
+
+    def time_noisy_shots(self, qobj, noise_model_wrapper, batched_shots):
+        """ Benchmark for noisy shots """
+        backend_options = {
+            'method': 'statevector',
+            'batched_shots': batched_shots,
+            'sparse_noise_threshold': 0
+        }
+        result = self.backend.run(
+            qobj, noise_model=noise_model_wrapper(),
+            backend_options=backend_options
+        ).result()
+        if result.status != 'COMPLETED':
+            raise QiskitError("Simulation failed. Status: " + result.status)
@@ -0,0 +1,145 @@
+#define CATCH_CONFIG_MAIN
+#include <cmath>
+#include <string>
+#include <catch.hpp>
+#include "controllers/qasm_controller.hpp"
+
+namespace AER{
+namespace Test{
+
+// Expose the automatic method choice of the QasmController
+class AutomaticController : public Simulator::QasmController {
+public:
+    using QasmController::Method;
+    using QasmController::automatic_simulation_method;
+};
+
+json_t gate(const std::string &name, const std::vector<uint_t> &qubits) {
+    return json_t::object({{"name", name}, {"qubits", qubits}});
+}
+
+Circuit make_circuit(uint_t num_qubits, const json_t &instructions, uint_t shots) {
+    json_t measure = gate("measure", {});
+    for (uint_t qubit = 0; qubit < num_qubits; ++qubit) {
+        measure["qubits"].push_back(qubit);
+        measure["memory"].push_back(qubit);
+    }
+    json_t ops = instructions;
+    ops.push_back(measure);
+    json_t circ = json_t::object({{"instructions", ops}});
+    circ["config"] = json_t::object({{"n_qubits", num_qubits},
+                                     {"memory_slots", num_qubits},
+                                     {"shots", shots}});
+    return Circuit(circ);
+}
+
+// Layers of single-qubit gates followed by a brickwork of nearest
+// neighbour CX gates
+json_t brickwork(uint_t num_qubits, uint_t layers, const std::string &name) {
+    json_t ops = json_t::array();
+    for (uint_t layer = 0; layer < layers; ++layer) {
+        for (uint_t qubit = 0; qubit < num_qubits; ++qubit) {
+            ops.push_back(gate(name, {qubit}));
+            ops.push_back(gate("h", {qubit}));
+        }
+        for (uint_t qubit = layer % 2; qubit + 1 < num_qubits; qubit += 2)
+            ops.push_back(gate("cx", {qubit, qubit + 1}));
+    }
+    return ops;
+}
+
+// Layers of T gates followed by CX gates between all pairs of qubits
+json_t all_to_all(uint_t num_qubits, uint_t layers) {
+    json_t ops = json_t::array();
+    for (uint_t layer = 0; layer < layers; ++layer) {
+        for (uint_t qubit = 0; qubit < num_qubits; ++qubit)
+            ops.push_back(gate("t", {qubit}));
+        for (uint_t i = 0; i < num_qubits; ++i)
+            for (uint_t j = i + 1; j < num_qubits; ++j)
+                ops.push_back(gate("cx", {i, j}));
+    }
+    return ops;
+}
+
+// Amplitude damping error on every T gate
+Noise::NoiseModel amplitude_damping_noise(double gamma) {
+    const double a = std::sqrt(1. - gamma);
+    const double b = std::sqrt(gamma);
+    json_t k0 = json_t::array({json_t::array({{1., 0.}, {0., 0.}}),
+                               json_t::array({{0., 0.}, {a, 0.}})});
+    json_t k1 = json_t::array({json_t::array({{0., 0.}, {b, 0.}}),
+                               json_t::array({{0., 0.}, {0., 0.}})});
+    json_t kraus = json_t::object({{"name", "kraus"},
+                                   {"qubits", json_t::array({0})},
+                                   {"params", json_t::array({k0, k1})}});
+    json_t error = json_t::object({{"type", "qerror"},
+                                   {"operations", json_t::array({"t"})},
+                                   {"instructions", json_t::array({json_t::array({kraus})})},
+                                   {"probabilities", json_t::array({1.})}});
+    return Noise::NoiseModel(json_t::object({{"errors", json_t::array({error})}}));
+}
+
+TEST_CASE( "Automatic simulation method", "[cost_model]" ) {
+    using Method = AutomaticController::Method;
+    AutomaticController controller;
+    controller.set_config(json_t::object({{"max_memory_mb", 4096}}));
+    const Noise::NoiseModel ideal;
+
+    SECTION( "Clifford circuits use the stabilizer method" ) {
+        auto circ = make_circuit(40, brickwork(40, 20, "s"), 1000);
+        REQUIRE(controller.automatic_simulation_method(circ, ideal) == Method::stabilizer);
+    }
+
+    SECTION( "Small dense circuits use the statevector method" ) {
+        auto circ = make_circuit(12, all_to_all(12, 10), 1000);
+        REQUIRE(controller.automatic_simulation_method(circ, ideal) == Method::statevector);
+    }
+
+    SECTION( "Deep nearest neighbour circuits use the statevector method" ) {
+        auto circ = make_circuit(20, brickwork(20, 40, "t"), 1000);
+        REQUIRE(controller.automatic_simulation_method(circ, ideal) == Method::statevector);
+    }
+
+    SECTION( "Large shallow circuits use the matrix product state method" ) {
+        auto circ = make_circuit(60, brickwork(60, 3, "t"), 100);
+        REQUIRE(controller.automatic_simulation_method(circ, ideal) == Method::matrix_product_state);
+    }
+
+    SECTION( "Small noisy circuits use the density matrix method" ) {
+        auto circ = make_circuit(6, brickwork(6, 10, "t"), 1000);
+        auto noise = amplitude_damping_noise(0.1);
+        REQUIRE(controller.automatic_simulation_method(circ, noise) == Method::density_matrix);
+    }
+
+    SECTION( "Estimates are added for each supported method" ) {
+        auto circ = make_circuit(12, all_to_all(12, 10), 1000);
+        json_t estimates;
+        controller.automatic_simulation_method(circ, ideal, false, &estimates);
+        for (const auto &name : {"statevector", "density_matrix", "matrix_product_state"}) {
+            REQUIRE(estimates.count(name) == 1);
+            REQUIRE(estimates[name]["runtime"].get<double>() > 0.);
+        }
+    }
+}
+
+TEST_CASE( "Default cost model estimates are finite", "[cost_model]" ) {
+    Simulator::DefaultCostModel model;
+    Simulator::CircuitFeatures features;
+    features.num_qubits = 500;
+    features.num_measure = 1;
+    features.num_non_clifford = 100000;
+    features.op_widths = {0, 100000, 100000};
+    features.cut_crossings.assign(500, 2000);
+
+    for (const auto &method : {"extended_stabilizer", "matrix_product_state"}) {
+        const auto cost = model.estimate(method, features);
+        REQUIRE(std::isfinite(cost.runtime));
+        REQUIRE(std::isfinite(cost.memory_mb));
+    }
+}
+
+//------------------------------------------------------------------------------
+} // end namespace Test
+//------------------------------------------------------------------------------
+} // end namespace AER
+//------------------------------------------------------------------------------
@@ -0,0 +1,121 @@
+#define CATCH_CONFIG_MAIN
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <catch.hpp>
+#include "framework/results/data/counts.hpp"
+
+namespace AER{
+namespace Test{
+
+TEST_CASE( "Counts of memory values of at most 64 bits", "[counts]" ) {
+    Counts counts;
+    REQUIRE(counts.empty());
+
+    SECTION( "Memory values are keyed by their integer value" ) {
+        counts.add(0);
+        counts.add(5, 3);
+        counts.add(reg_t({5}), 3, 3);
+        counts.add(reg_t({0xffffffffffffffffULL}), 64, 2);
+        const std::map<std::string, uint_t> expected = {
+            {"0x0", 1}, {"0x5", 6}, {"0xffffffffffffffff", 2}};
+        REQUIRE(counts.hex_counts() == expected);
+        REQUIRE(counts.values().size() == 3);
+    }
+
+    SECTION( "Hex strings of at most 16 digits are added by value" ) {
+        counts.add(std::string("0x5"), 2);
+        counts.add(5);
+        counts.add(std::string("0xffffffffffffffff"));
+        const std::map<std::string, uint_t> expected = {
+            {"0x5", 3}, {"0xffffffffffffffff", 1}};
+        REQUIRE(counts.hex_counts() == expected);
+    }
+
+    SECTION( "Memory values without bits are ignored" ) {
+        counts.add(reg_t({1}), 0);
+        counts.add(std::string());
+        REQUIRE(counts.empty());
+    }
+}
+
+TEST_CASE( "Counts of memory values of more than 64 bits", "[counts]" ) {
+    Counts counts;
+
+    SECTION( "Memory values are keyed by their words" ) {
+        counts.add(reg_t({5, 0}), 70, 2);
+        counts.add(reg_t({5, 1}), 70);
+        counts.add(reg_t({5, 0}), 70);
+        const std::map<std::string, uint_t> expected = {
+            {"0x00000000000000005", 3}, {"0x10000000000000005", 1}};
+        REQUIRE(counts.hex_counts() == expected);
+        REQUIRE(counts.values().size() == 2);
+    }
+
+    SECTION( "Hex strings are padded to the words of the memory bits" ) {
+        counts.add(reg_t({1, 2, 3}), 130);
+        const std::map<std::string, uint_t> expected = {
+            {"0x300000000000000020000000000000001", 1}};
+        REQUIRE(counts.hex_counts() == expected);
+    }
+
+    SECTION( "Hex strings of more than 16 digits are merged with words" ) {
+        counts.add(reg_t({5, 0}), 70);
+        counts.add(std::string("0x00000000000000005"), 2);
+        const std::map<std::string, uint_t> expected = {
+            {"0x00000000000000005", 3}};
+        REQUIRE(counts.hex_counts() == expected);
+        REQUIRE(counts.values() == std::vector<uint_t>({3}));
+    }
+
+    SECTION( "Memory values must have the same number of bits" ) {
+        counts.add(reg_t({5, 0}), 70);
+        REQUIRE_THROWS_AS(counts.add(reg_t({5, 0}), 100), std::invalid_argument);
+    }
+}
+
+TEST_CASE( "Combining counts", "[counts]" ) {
+    Counts counts;
+    counts.add(3, 2);
+    counts.add(reg_t({5, 1}), 70);
+
+    SECTION( "Counts of the same memory values are added" ) {
+        Counts other;
+        other.add(3);
+        other.add(7);
+        other.add(reg_t({5, 1}), 70, 4);
+        counts.combine(other);
+        const std::map<std::string, uint_t> expected = {
+            {"0x3", 3}, {"0x7", 1}, {"0x10000000000000005", 5}};
+        REQUIRE(counts.hex_counts() == expected);
+    }
+
+    SECTION( "Combining with empty counts keeps the counts" ) {
+        const auto expected = counts.hex_counts();
+        counts.combine(Counts());
+        REQUIRE(counts.hex_counts() == expected);
+        Counts empty;
+        empty.combine(counts);
+        REQUIRE(empty.hex_counts() == expected);
+    }
+
+    SECTION( "Word counts must have the same number of bits" ) {
+        Counts other;
+        other.add(reg_t({5, 1}), 100);
+        REQUIRE_THROWS_AS(counts.combine(other), std::invalid_argument);
+    }
+
+    SECTION( "Clear removes all counts" ) {
+        counts.clear();
+        REQUIRE(counts.empty());
+        counts.add(reg_t({5, 1}), 100);
+        REQUIRE(counts.hex_counts().size() == 1);
+    }
+}
+
+//------------------------------------------------------------------------------
+} // end namespace Test
+//------------------------------------------------------------------------------
+} // end namespace AER
+//------------------------------------------------------------------------------
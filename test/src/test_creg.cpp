@@ -0,0 +1,76 @@
+#define CATCH_CONFIG_MAIN
+#include <string>
+#include <catch.hpp>
+#include "framework/creg.hpp"
+
+namespace AER{
+namespace Test{
+
+Operations::Op bfunc(const std::string &mask, const std::string &relation,
+                     const std::string &val, uint_t reg) {
+    return Operations::json_to_op(json_t::object({{"name", "bfunc"},
+                                                  {"mask", mask},
+                                                  {"relation", relation},
+                                                  {"val", val},
+                                                  {"register", reg}}));
+}
+
+TEST_CASE( "Boolean functions of registers wider than 64 bits", "[creg]" ) {
+    // Register bits 0, 64 and 128 of a 130-bit register are 1
+    ClassicalRegister creg;
+    creg.initialize(0, 130);
+    creg.store_measure({1, 1, 1}, {}, {0, 64, 128});
+    REQUIRE(creg.register_hex() == "0x10000000000000001" + std::string(15, '0') + "1");
+
+    const std::string high = "0x3" + std::string(32, '0');
+    const std::string low = "0xffffffffffffffff";
+    const std::string all = "0x3" + std::string(32, 'f');
+
+    SECTION( "Masks select bits in the high words" ) {
+        creg.apply_bfunc(bfunc(high, "==", "0x1" + std::string(32, '0'), 129));
+        Operations::Op cond;
+        cond.conditional = true;
+        cond.conditional_reg = 129;
+        REQUIRE(creg.check_conditional(cond) == true);
+    }
+
+    SECTION( "Values below the high words are not equal" ) {
+        Operations::Op cond;
+        cond.conditional = true;
+        cond.conditional_reg = 129;
+        creg.apply_bfunc(bfunc(high, "==", "0x1", 129));
+        REQUIRE(creg.check_conditional(cond) == false);
+        creg.apply_bfunc(bfunc(high, ">", "0x1", 129));
+        REQUIRE(creg.check_conditional(cond) == true);
+    }
+
+    SECTION( "Words are compared from the most significant word" ) {
+        Operations::Op cond;
+        cond.conditional = true;
+        cond.conditional_reg = 129;
+        // The masked value 0x1...01 is greater than 0x0ff...f
+        const std::string below = "0x" + std::string(32, 'f');
+        creg.apply_bfunc(bfunc(all, ">", below, 129));
+        REQUIRE(creg.check_conditional(cond) == true);
+        creg.apply_bfunc(bfunc(all, "<=", below, 129));
+        REQUIRE(creg.check_conditional(cond) == false);
+        // The low word alone is 1
+        creg.apply_bfunc(bfunc(low, "==", "0x1", 129));
+        REQUIRE(creg.check_conditional(cond) == true);
+        creg.apply_bfunc(bfunc(low, "!=", "0x1", 129));
+        REQUIRE(creg.check_conditional(cond) == false);
+    }
+
+    SECTION( "The outcome is stored in a register bit of a high word" ) {
+        creg.apply_bfunc(bfunc(all, "==", creg.register_hex(), 127));
+        REQUIRE(creg.register_hex() == "0x18000000000000001" + std::string(15, '0') + "1");
+        creg.apply_bfunc(bfunc(all, ">=", "0x2" + std::string(32, '0'), 127));
+        REQUIRE(creg.register_hex() == "0x10000000000000001" + std::string(15, '0') + "1");
+    }
+}
+
+//------------------------------------------------------------------------------
+} // end namespace Test
+//------------------------------------------------------------------------------
+} // end namespace AER
+//------------------------------------------------------------------------------
@@ -0,0 +1,63 @@
+#define CATCH_CONFIG_MAIN
+#include <stdexcept>
+#include <string>
+#include <catch.hpp>
+#include "controllers/qasm_controller.hpp"
+
+namespace AER{
+namespace Test{
+
+// Result of a noisy qobj with counts, memory and a statevector snapshot
+json_t qobj_result() {
+    const std::string qobj = R"({
+        "qobj_id": "serialize", "schema_version": "1.0", "type": "QASM",
+        "config": {"shots": 20, "memory": true, "seed_simulator": 7,
+                   "method": "statevector"},
+        "experiments": [{
+            "header": {"name": "circ"},
+            "config": {"n_qubits": 2, "memory_slots": 2},
+            "instructions": [
+                {"name": "h", "qubits": [0]},
+                {"name": "u3", "qubits": [1], "params": [0.3, 0.2, 0.1]},
+                {"name": "snapshot", "type": "statevector", "label": "sv",
+                 "qubits": [0, 1]},
+                {"name": "measure", "qubits": [0, 1], "memory": [0, 1]}
+            ]}]
+    })";
+    Simulator::QasmController controller;
+    return controller.execute(json_t::parse(qobj)).json();
+}
+
+TEST_CASE( "Serialized results decode to the JSON result", "[json]" ) {
+    const json_t result = qobj_result();
+    REQUIRE(result["success"].get<bool>());
+
+    SECTION( "JSON text" ) {
+        REQUIRE(json_t::parse(JSON::serialize(result, "json")) == result);
+    }
+
+    SECTION( "MessagePack" ) {
+        const std::string data = JSON::serialize(result, "msgpack");
+        REQUIRE(data != result.dump());
+        REQUIRE(json_t::from_msgpack(data) == result);
+    }
+
+    SECTION( "CBOR" ) {
+        const std::string data = JSON::serialize(result, "cbor");
+        REQUIRE(data != result.dump());
+        REQUIRE(json_t::from_cbor(data) == result);
+    }
+}
+
+TEST_CASE( "Serialization formats are checked", "[json]" ) {
+    for (const auto &format : {"json", "msgpack", "cbor"})
+        REQUIRE_NOTHROW(JSON::check_format(format));
+    REQUIRE_THROWS_AS(JSON::check_format("yaml"), std::invalid_argument);
+    REQUIRE_THROWS_AS(JSON::serialize(json_t::object(), ""), std::invalid_argument);
+}
+
+//------------------------------------------------------------------------------
+} // end namespace Test
+//------------------------------------------------------------------------------
+} // end namespace AER
+//------------------------------------------------------------------------------
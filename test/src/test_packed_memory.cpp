@@ -0,0 +1,123 @@
+#define CATCH_CONFIG_MAIN
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <catch.hpp>
+#include "framework/results/experiment_data.hpp"
+
+namespace AER{
+namespace Test{
+
+// Memory values of three shots of a number of bits
+std::vector<reg_t> memory_values(uint_t num_bits) {
+    const uint_t num_words = (num_bits + 63) / 64;
+    std::vector<reg_t> values(3, reg_t(num_words, 0));
+    for (uint_t bit = 0; bit < num_bits; ++bit) {
+        // All bits, every third bit, and the most significant bit
+        values[0][bit / 64] |= 1ULL << (bit % 64);
+        if (bit % 3 == 0)
+            values[1][bit / 64] |= 1ULL << (bit % 64);
+        if (bit + 1 == num_bits)
+            values[2][bit / 64] |= 1ULL << (bit % 64);
+    }
+    return values;
+}
+
+TEST_CASE( "Packed memory of different numbers of bits", "[packed_memory]" ) {
+    for (const uint_t num_bits : {1, 8, 64, 70}) {
+        const auto values = memory_values(num_bits);
+        PackedMemory memory;
+        memory.reserve(values.size());
+        for (const auto &value : values)
+            memory.add(value, num_bits);
+
+        INFO("num_bits = " << num_bits);
+        REQUIRE(memory.shots() == 3);
+        REQUIRE(memory.num_bits() == num_bits);
+        REQUIRE(memory.num_bytes() == (num_bits + 7) / 8);
+        REQUIRE(memory.bytes().size() == 3 * memory.num_bytes());
+
+        // Bit j of a shot is bit j % 8 of byte j / 8 of its row
+        const auto &bytes = memory.bytes();
+        const uint_t top = num_bits - 1;
+        REQUIRE(bytes[2 * memory.num_bytes() + top / 8] == (1U << (top % 8)));
+        REQUIRE(bytes[memory.num_bytes()] == ((num_bits < 8) ? 0x01 : 0x49));
+
+        for (uint_t shot = 0; shot < 3; ++shot) {
+            REQUIRE(memory.words(shot) == values[shot]);
+            REQUIRE(memory.hex(shot) == Utils::words2hex(values[shot]));
+        }
+        REQUIRE(memory.hex() == std::vector<std::string>({
+            Utils::words2hex(values[0]), Utils::words2hex(values[1]),
+            Utils::words2hex(values[2])}));
+    }
+}
+
+TEST_CASE( "Combining packed memory", "[packed_memory]" ) {
+    const auto values = memory_values(70);
+    PackedMemory memory;
+    memory.add(values[0], 70);
+
+    SECTION( "Shots of the other memory are appended" ) {
+        PackedMemory other;
+        other.add(values[1], 70);
+        other.add(values[2], 70);
+        memory.combine(other);
+        REQUIRE(memory.shots() == 3);
+        REQUIRE(other.shots() == 2);
+        for (uint_t shot = 0; shot < 3; ++shot)
+            REQUIRE(memory.words(shot) == values[shot]);
+    }
+
+    SECTION( "Moved memory is cleared" ) {
+        PackedMemory other;
+        other.add(values[1], 70);
+        memory.combine(std::move(other));
+        REQUIRE(memory.shots() == 2);
+        REQUIRE(memory.words(1) == values[1]);
+        REQUIRE(other.empty());
+    }
+
+    SECTION( "Combining into empty memory copies the number of bits" ) {
+        PackedMemory empty;
+        empty.combine(memory);
+        REQUIRE(empty.num_bits() == 70);
+        REQUIRE(empty.words(0) == values[0]);
+        memory.combine(PackedMemory());
+        REQUIRE(memory.shots() == 1);
+    }
+
+    SECTION( "Memory values must have the same number of bits" ) {
+        PackedMemory other;
+        other.add(reg_t({1}), 8);
+        REQUIRE_THROWS_AS(memory.combine(other), std::invalid_argument);
+        REQUIRE_THROWS_AS(memory.add(reg_t({1}), 8), std::invalid_argument);
+    }
+}
+
+TEST_CASE( "Packed memory checkpoints", "[packed_memory]" ) {
+    for (const uint_t num_bits : {1, 8, 64, 70}) {
+        INFO("num_bits = " << num_bits);
+        ExperimentData data;
+        data.set_config(json_t::object({{"memory", true}}));
+        for (const auto &value : memory_values(num_bits)) {
+            data.add_pershot_memory(value, num_bits);
+            data.end_shot();
+        }
+
+        ExperimentData restored;
+        restored.set_config(json_t::object({{"memory", true}}));
+        const json_t js = data.checkpoint();
+        REQUIRE(js["memory_bits"].get<uint_t>() == num_bits);
+        restored.load_checkpoint(js);
+        REQUIRE(restored.memory_.num_bits() == num_bits);
+        REQUIRE(restored.memory_.bytes() == data.memory_.bytes());
+        REQUIRE(restored.json()["memory"] == data.json()["memory"]);
+    }
+}
+
+//------------------------------------------------------------------------------
+} // end namespace Test
+//------------------------------------------------------------------------------
+} // end namespace AER
+//------------------------------------------------------------------------------
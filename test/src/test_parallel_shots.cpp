@@ -0,0 +1,104 @@
+#define CATCH_CONFIG_MAIN
+#include <string>
+#include <catch.hpp>
+#include "controllers/qasm_controller.hpp"
+
+namespace AER{
+namespace Test{
+
+// Expose the circuit execution of a single shot thread
+class ShotsController : public Simulator::QasmController {
+public:
+    using QasmController::run_circuit;
+};
+
+// A noisy circuit with memory, register and snapshot data which is executed
+// shot by shot. The expectation value snapshot is taken before any errors
+// so its average doesn't depend on the shots.
+json_t noisy_qobj(int parallel_shots) {
+    json_t qobj = json_t::parse(R"({
+        "qobj_id": "parallel", "schema_version": "1.0", "type": "QASM",
+        "config": {"shots": 1001, "memory": true, "register": true,
+                   "seed_simulator": 13, "method": "statevector",
+                   "sparse_noise_threshold": 0,
+                   "noise_model": {"errors": [{
+                       "type": "qerror", "operations": ["cx"],
+                       "probabilities": [0.8, 0.2],
+                       "instructions": [[{"name": "id", "qubits": [0]}],
+                                        [{"name": "x", "qubits": [1]}]]}]}},
+        "experiments": [{
+            "config": {"n_qubits": 3, "memory_slots": 3},
+            "instructions": [
+                {"name": "u3", "qubits": [0], "params": [0.7, 0, 0]},
+                {"name": "h", "qubits": [2]},
+                {"name": "snapshot", "type": "expectation_value_pauli",
+                 "label": "z", "qubits": [0], "params": [[[1, 0], "Z"]]},
+                {"name": "snapshot", "type": "statevector", "label": "sv",
+                 "qubits": [0, 1, 2]},
+                {"name": "cx", "qubits": [0, 1]},
+                {"name": "measure", "qubits": [0, 1, 2], "memory": [0, 1, 2],
+                 "register": [0, 1, 2]}
+            ]}]
+    })");
+    qobj["config"]["max_parallel_threads"] = parallel_shots;
+    qobj["config"]["max_parallel_shots"] = parallel_shots;
+    return qobj;
+}
+
+TEST_CASE( "Parallel shot threads are merged in order", "[parallel_shots]" ) {
+#ifdef _OPENMP
+    omp_set_num_threads(5);
+#endif
+    const uint_t shots = 1001;
+    Simulator::QasmController serial_controller;
+    const json_t serial = serial_controller.execute(noisy_qobj(1)).json()["results"][0];
+    REQUIRE(serial["metadata"]["parallel_shots"] == 1);
+
+    ShotsController controller;
+    const json_t qobj = noisy_qobj(5);
+    const json_t result = controller.execute(qobj).json()["results"][0];
+    REQUIRE(result["success"].get<bool>());
+#ifdef _OPENMP
+    REQUIRE(result["metadata"]["parallel_shots"] == 5);
+#endif
+    const json_t &data = result["data"];
+
+    SECTION( "Totals and averages match a serial run" ) {
+        uint_t total = 0;
+        for (const auto &count : data["counts"].items())
+            total += count.value().get<uint_t>();
+        REQUIRE(total == shots);
+        REQUIRE(data["memory"].size() == shots);
+        REQUIRE(data["register"].size() == shots);
+        REQUIRE(data["snapshots"]["statevector"]["sv"].size() == shots);
+        const json_t &avg = data["snapshots"]["expectation_value"]["z"][0]["value"];
+        const json_t &expected = serial["data"]["snapshots"]["expectation_value"]["z"][0]["value"];
+        REQUIRE(avg[0].get<double>() == Approx(expected[0].get<double>()));
+        REQUIRE(avg[0].get<double>() == Approx(std::cos(0.7)));
+    }
+
+    SECTION( "Data equals the shot threads combined in order" ) {
+        // The shots are split between the threads as 201, 200, 200, 200, 200
+        // and thread j uses the seed 13 + j
+        Qobj qobj_circuits(qobj);
+        Noise::NoiseModel noise(qobj["config"]["noise_model"]);
+        ExperimentData combined;
+        combined.set_config(qobj["config"]);
+        for (uint_t j = 0; j < 5; ++j) {
+            combined.combine(controller.run_circuit(
+                qobj_circuits.circuits[0], noise, qobj["config"],
+                (j == 0) ? 201 : 200, 13 + j));
+        }
+        const json_t expected = combined.json();
+        REQUIRE(data["counts"] == expected["counts"]);
+        REQUIRE(data["memory"] == expected["memory"]);
+        REQUIRE(data["register"] == expected["register"]);
+        REQUIRE(data["snapshots"] == expected["snapshots"]);
+    }
+}
+
+//------------------------------------------------------------------------------
+} // end namespace Test
+//------------------------------------------------------------------------------
+} // end namespace AER
+//------------------------------------------------------------------------------
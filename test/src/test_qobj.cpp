@@ -0,0 +1,164 @@
+#define CATCH_CONFIG_MAIN
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <catch.hpp>
+#include "framework/qobj.hpp"
+
+namespace AER{
+namespace Test{
+
+// A qobj whose config follows its experiments, so the circuits can only
+// be constructed after the whole qobj has been parsed
+const std::string qobj_text = R"({
+    "qobj_id": "parse",
+    "schema_version": "1.0",
+    "type": "QASM",
+    "header": {"backend_name": "qasm_simulator"},
+    "experiments": [
+        {
+            "header": {"name": "first"},
+            "instructions": [
+                {"name": "h", "qubits": [0]},
+                {"name": "unitary", "qubits": [1],
+                 "params": [[[[0, 0], [1, 0]], [[1, 0], [0, 0]]]]},
+                {"name": "measure", "qubits": [0], "memory": [0], "register": [0]},
+                {"name": "bfunc", "mask": "0x1", "relation": "==", "val": "0x1",
+                 "register": 1},
+                {"name": "x", "qubits": [2], "conditional": 1},
+                {"name": "measure", "qubits": [1, 2], "memory": [1, 2]}
+            ]
+        },
+        {
+            "header": {"name": "second"},
+            "config": {"shots": 7, "n_qubits": 4},
+            "instructions": [
+                {"name": "u3", "qubits": [3], "params": [0.1, 0.2, 0.3]},
+                {"name": "measure", "qubits": [3], "memory": [0]}
+            ]
+        }
+    ],
+    "config": {"shots": 100, "seed_simulator": 11, "n_qubits": 3,
+               "memory_slots": 3}
+})";
+
+void require_same_qobj(const Qobj &parsed, const Qobj &loaded) {
+    REQUIRE(parsed.id == loaded.id);
+    REQUIRE(parsed.type == loaded.type);
+    REQUIRE(parsed.header == loaded.header);
+    REQUIRE(parsed.config == loaded.config);
+    REQUIRE(parsed.circuits.size() == loaded.circuits.size());
+    for (size_t j = 0; j < parsed.circuits.size(); ++j) {
+        const auto &circ = parsed.circuits[j];
+        const auto &expected = loaded.circuits[j];
+        REQUIRE(circ.shots == expected.shots);
+        REQUIRE(circ.seed == expected.seed);
+        REQUIRE(circ.num_qubits == expected.num_qubits);
+        REQUIRE(circ.num_memory == expected.num_memory);
+        REQUIRE(circ.num_registers == expected.num_registers);
+        REQUIRE(circ.header == expected.header);
+        REQUIRE(circ.ops.size() == expected.ops.size());
+        for (size_t pos = 0; pos < circ.ops.size(); ++pos)
+            REQUIRE(json_t(circ.ops[pos]) == json_t(expected.ops[pos]));
+    }
+}
+
+TEST_CASE( "Parsed qobjs match qobjs loaded from JSON", "[qobj]" ) {
+    const Qobj loaded(json_t::parse(qobj_text));
+    REQUIRE(loaded.circuits.size() == 2);
+    REQUIRE(loaded.circuits[0].shots == 100);
+    REQUIRE(loaded.circuits[1].shots == 7);
+    REQUIRE(loaded.circuits[0].seed == 11);
+    REQUIRE(loaded.circuits[1].seed == 11 + 2113);
+
+    SECTION( "Parsing a string" ) {
+        require_same_qobj(Qobj::parse(qobj_text), loaded);
+    }
+
+    SECTION( "Parsing a stream" ) {
+        std::istringstream stream(qobj_text);
+        require_same_qobj(Qobj::parse(stream), loaded);
+    }
+
+    SECTION( "Extra config values replace the qobj config" ) {
+        json_t js = json_t::parse(qobj_text);
+        js["config"]["shots"] = 50;
+        js["config"]["result_format"] = "cbor";
+        const json_t extra = json_t::object({{"shots", 50},
+                                             {"result_format", "cbor"}});
+        require_same_qobj(Qobj::parse(qobj_text, extra), Qobj(js));
+    }
+}
+
+TEST_CASE( "Parsing invalid qobjs", "[qobj]" ) {
+    json_t js = json_t::parse(qobj_text);
+
+    SECTION( "Experiments must be a list" ) {
+        js["experiments"] = json_t::object();
+        REQUIRE_THROWS_AS(Qobj::parse(js.dump()), std::invalid_argument);
+        REQUIRE_THROWS_AS(Qobj(js), std::invalid_argument);
+    }
+
+    SECTION( "Invalid instructions are reported" ) {
+        js["experiments"][0]["instructions"][3]["relation"] = "=~";
+        REQUIRE_THROWS_AS(Qobj::parse(js.dump()), std::invalid_argument);
+    }
+}
+
+// The error message of loading a qobj from JSON
+std::string load_error(const json_t &js) {
+    try {
+        Qobj qobj(js);
+    } catch (std::invalid_argument &e) {
+        return e.what();
+    }
+    return std::string();
+}
+
+TEST_CASE( "Loading experiments in parallel", "[qobj]" ) {
+#ifdef _OPENMP
+    omp_set_num_threads(4);
+#endif
+    // More experiments than the parallel loading threshold
+    const size_t num_experiments = 20;
+    json_t js = json_t::parse(qobj_text);
+    const json_t experiment = js["experiments"][0];
+    js["experiments"] = json_t::array();
+    for (size_t j = 0; j < num_experiments; ++j)
+        js["experiments"].push_back(experiment);
+
+    SECTION( "Seeds are shifted for each experiment" ) {
+        const Qobj loaded(js);
+        REQUIRE(loaded.circuits.size() == num_experiments);
+        for (size_t j = 0; j < num_experiments; ++j)
+            REQUIRE(loaded.circuits[j].seed == 11 + 2113 * j);
+        require_same_qobj(Qobj::parse(js.dump()), loaded);
+    }
+
+    SECTION( "Errors match loading the invalid experiment alone" ) {
+        json_t invalid = experiment;
+        invalid["instructions"][3]["relation"] = "=~";
+        json_t serial = js;
+        serial["experiments"] = json_t::array({invalid});
+        const std::string expected = load_error(serial);
+        REQUIRE(!expected.empty());
+
+        // The error of the first invalid experiment is reported
+        js["experiments"][17] = invalid;
+        invalid["instructions"][3]["relation"] = "=";
+        js["experiments"][18] = invalid;
+        REQUIRE(load_error(js) == expected);
+        try {
+            Qobj::parse(js.dump());
+            FAIL("invalid experiment was parsed");
+        } catch (std::invalid_argument &e) {
+            REQUIRE(std::string(e.what()) == expected);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+} // end namespace Test
+//------------------------------------------------------------------------------
+} // end namespace AER
+//------------------------------------------------------------------------------
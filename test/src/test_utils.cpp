@@ -3,7 +3,14 @@
 #include <catch.hpp>
 #include <cmath>
 #include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
 #include "framework/linalg/almost_equal.hpp"
+#include "framework/operations.hpp"
+#include "framework/rng.hpp"
+#include "framework/utils.hpp"
+#include "noise/readout_error.hpp"
 #include "utils.hpp"
 
 namespace AER{
@@ -27,6 +34,137 @@ TEST_CASE( "Framework Utilities", "[almost_equal]" ) {
     }
 }
 
+TEST_CASE( "Hex strings and 64-bit words", "[hex2words]" ) {
+    SECTION( "Empty hex strings have no words" ) {
+        REQUIRE(Utils::hex2words("").empty());
+        REQUIRE(Utils::hex2words("0x").empty());
+        REQUIRE(Utils::words2hex(reg_t()).empty());
+    }
+
+    SECTION( "Zero is a single word" ) {
+        REQUIRE(Utils::hex2words("0x0") == reg_t({0}));
+        REQUIRE(Utils::words2hex(reg_t({0})) == "0x0");
+    }
+
+    SECTION( "64 bits fit in a single word" ) {
+        const std::string hex = "0xffffffffffffffff";
+        const reg_t words = {0xffffffffffffffffULL};
+        REQUIRE(Utils::hex2words(hex) == words);
+        REQUIRE(Utils::words2hex(words) == hex);
+        REQUIRE(Utils::words2hex(words, false) == hex.substr(2));
+    }
+
+    SECTION( "65 bits use a second word" ) {
+        const std::string hex = "0x18000000000000001";
+        const reg_t words = {0x8000000000000001ULL, 1};
+        REQUIRE(Utils::hex2words(hex) == words);
+        REQUIRE(Utils::words2hex(words) == hex);
+        REQUIRE(Utils::words2hex(words) == Utils::bin2hex("1" + Utils::int2bin(words[0], 64)));
+    }
+
+    SECTION( "Words below the most significant word keep leading zeros" ) {
+        const std::string hex = "0x20000000000000000000000000000000a";
+        const reg_t words = {0xa, 0, 2};
+        REQUIRE(Utils::hex2words(hex) == words);
+        REQUIRE(Utils::words2hex(words) == hex);
+        REQUIRE(Utils::words2hex(words) ==
+                Utils::bin2hex("10" + std::string(64, '0') + Utils::int2bin(0xa, 64)));
+    }
+
+    SECTION( "Leading zero words of 130 bits round trip" ) {
+        const reg_t words = {5, 0, 0};
+        const std::string hex = Utils::words2hex(words);
+        REQUIRE(hex == "0x0" + std::string(31, '0') + "5");
+        REQUIRE(Utils::hex2words(hex) == words);
+        REQUIRE(hex == Utils::bin2hex(std::string(127, '0') + "101"));
+    }
+}
+
+// Fraction of a uniform grid of points in [0, 1) sampled as each outcome
+std::vector<double> grid_frequencies(const AliasTable &table, uint_t points) {
+    std::vector<double> freqs(table.size(), 0.);
+    for (uint_t j = 0; j < points; ++j)
+        freqs[table.sample((j + 0.5) / points)] += 1. / points;
+    return freqs;
+}
+
+TEST_CASE( "Alias tables", "[alias_table]" ) {
+    const uint_t points = 1000000;
+
+    SECTION( "Outcomes are sampled with their probabilities" ) {
+        const std::vector<double> probs = {0.1, 0.2, 0.3, 0.4};
+        const AliasTable table(probs);
+        REQUIRE(table.size() == 4);
+        const auto freqs = grid_frequencies(table, points);
+        for (size_t j = 0; j < probs.size(); ++j)
+            REQUIRE(freqs[j] == Approx(probs[j]).margin(1e-5));
+
+        // Random samples are within 5 standard deviations
+        RngEngine rng;
+        rng.set_seed(7);
+        const uint_t shots = 100000;
+        std::vector<double> counts(probs.size(), 0.);
+        for (uint_t shot = 0; shot < shots; ++shot)
+            counts[rng.rand_int(table)] += 1.;
+        for (size_t j = 0; j < probs.size(); ++j) {
+            const double sigma = std::sqrt(probs[j] * (1. - probs[j]) / shots);
+            REQUIRE(counts[j] / shots == Approx(probs[j]).margin(5 * sigma));
+        }
+    }
+
+    SECTION( "Outcomes with zero probability are never sampled" ) {
+        const std::vector<double> probs = {0., 0.5, 0., 0.25, 0.25, 0.};
+        const auto freqs = grid_frequencies(AliasTable(probs), points);
+        for (size_t j = 0; j < probs.size(); ++j) {
+            if (probs[j] == 0.)
+                REQUIRE(freqs[j] == 0.);
+            else
+                REQUIRE(freqs[j] == Approx(probs[j]).margin(1e-5));
+        }
+    }
+
+    SECTION( "Tables of a single outcome always sample it" ) {
+        const AliasTable table(std::vector<double>({1.}));
+        REQUIRE(table.size() == 1);
+        for (const double u : {0., 0.25, 0.5, 0.999999})
+            REQUIRE(table.sample(u) == 0);
+        const AliasTable certain(std::vector<double>({0., 1., 0.}));
+        const auto freqs = grid_frequencies(certain, points);
+        REQUIRE(freqs[1] == Approx(1.));
+    }
+
+    SECTION( "Probabilities are normalized" ) {
+        const auto freqs = grid_frequencies(AliasTable({2., 6.}), points);
+        REQUIRE(freqs[0] == Approx(0.25).margin(1e-5));
+        REQUIRE(freqs[1] == Approx(0.75).margin(1e-5));
+    }
+
+    SECTION( "Invalid probabilities" ) {
+        REQUIRE_THROWS_AS(AliasTable(std::vector<double>()), std::invalid_argument);
+        REQUIRE_THROWS_AS(AliasTable({0., 0.}), std::invalid_argument);
+        REQUIRE_THROWS_AS(AliasTable({0.5, -0.1, 0.6}), std::invalid_argument);
+        REQUIRE(AliasTable().empty());
+        REQUIRE(AliasTable().sample(0.5) == 0);
+    }
+
+    SECTION( "Copies of readout error ops share their tables" ) {
+        const auto op = Operations::make_roerror({0}, {{0.9, 0.1}, {0.2, 0.8}});
+        const auto copy = op;
+        REQUIRE(op.probs_tables);
+        REQUIRE(op.probs_tables->size() == 2);
+        REQUIRE(copy.probs_tables.get() == op.probs_tables.get());
+
+        // Sampled readout errors use the tables of the ReadoutError
+        Noise::ReadoutError error;
+        error.set_probabilities({{0.9, 0.1}, {0.2, 0.8}});
+        RngEngine rng;
+        const auto first = error.sample_noise({0}, rng);
+        const auto second = error.sample_noise({1}, rng);
+        REQUIRE(first[0].probs_tables);
+        REQUIRE(first[0].probs_tables.get() == second[0].probs_tables.get());
+    }
+}
+
 
 //------------------------------------------------------------------------------
 } // end namespace Test
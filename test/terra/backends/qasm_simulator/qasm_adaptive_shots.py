@@ -0,0 +1,129 @@
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2018, 2019, 2020.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+
+"""
+QasmSimulator Integration Tests
+"""
+
+from qiskit import QuantumCircuit
+from qiskit.compiler import assemble
+from qiskit.providers.aer import QasmSimulator
+from qiskit.providers.aer.noise import NoiseModel
+from qiskit.providers.aer.noise.errors import depolarizing_error
+
+
+class QasmAdaptiveShotsTests:
+    """QasmSimulator adaptive shots tests."""
+
+    SIMULATOR = QasmSimulator()
+    BACKEND_OPTS = {}
+
+    def noisy_bell_circuit(self):
+        """Noisy Bell circuit that requires trajectory simulation."""
+        circuit = QuantumCircuit(2, 2)
+        circuit.h(0)
+        circuit.cx(0, 1)
+        circuit.measure([0, 1], [0, 1])
+        noise_model = NoiseModel()
+        noise_model.add_all_qubit_quantum_error(
+            depolarizing_error(0.1, 1), ['h'])
+        return circuit, noise_model
+
+    def test_adaptive_shots_converged(self):
+        """Test adaptive shots stop once the target error is reached"""
+        circuit, noise_model = self.noisy_bell_circuit()
+        shots = 100000
+        qobj = assemble([circuit], self.SIMULATOR, shots=shots,
+                        seed_simulator=1)
+        backend_options = self.BACKEND_OPTS.copy()
+        backend_options['adaptive_shots'] = True
+        backend_options['adaptive_shots_target_error'] = 0.01
+        backend_options['adaptive_shots_batch_size'] = 100
+        result = self.SIMULATOR.run(
+            qobj, noise_model=noise_model,
+            backend_options=backend_options).result()
+        self.assertTrue(getattr(result, 'success', False))
+        metadata = result.results[0].metadata.get('adaptive_shots')
+        self.assertIsNotNone(metadata)
+        self.assertTrue(metadata.get('converged'))
+        self.assertLessEqual(metadata.get('standard_error'), 0.01)
+        executed = metadata.get('shots')
+        self.assertLess(executed, shots)
+        self.assertEqual(executed % 100, 0)
+        self.assertEqual(sum(result.get_counts(0).values()), executed)
+
+    def test_adaptive_shots_max_shots(self):
+        """Test adaptive shots never exceed the requested shots"""
+        circuit, noise_model = self.noisy_bell_circuit()
+        shots = 250
+        qobj = assemble([circuit], self.SIMULATOR, shots=shots,
+                        seed_simulator=1)
+        backend_options = self.BACKEND_OPTS.copy()
+        backend_options['adaptive_shots'] = True
+        backend_options['adaptive_shots_target_error'] = 1e-6
+        result = self.SIMULATOR.run(
+            qobj, noise_model=noise_model,
+            backend_options=backend_options).result()
+        self.assertTrue(getattr(result, 'success', False))
+        metadata = result.results[0].metadata.get('adaptive_shots')
+        self.assertFalse(metadata.get('converged'))
+        self.assertEqual(metadata.get('shots'), shots)
+        self.assertEqual(sum(result.get_counts(0).values()), shots)
+
+    def test_adaptive_shots_rare_outcome(self):
+        """Test adaptive shots do not stop before a rare outcome is seen"""
+        # The outcome 1 has probability sin(0.05)^2 ~ 0.25%
+        circuit = QuantumCircuit(1, 1)
+        circuit.ry(0.1, 0)
+        circuit.measure(0, 0)
+        noise_model = NoiseModel()
+        noise_model.add_all_qubit_quantum_error(
+            depolarizing_error(0.001, 1), ['ry'])
+        shots = 100000
+        qobj = assemble([circuit], self.SIMULATOR, shots=shots,
+                        seed_simulator=1)
+        backend_options = self.BACKEND_OPTS.copy()
+        backend_options['adaptive_shots'] = True
+        backend_options['adaptive_shots_target_error'] = 0.01
+        backend_options['adaptive_shots_batch_size'] = 100
+        result = self.SIMULATOR.run(
+            qobj, noise_model=noise_model,
+            backend_options=backend_options).result()
+        self.assertTrue(getattr(result, 'success', False))
+        metadata = result.results[0].metadata.get('adaptive_shots')
+        self.assertTrue(metadata.get('converged'))
+        self.assertGreater(metadata.get('standard_error'), 0)
+        self.assertGreaterEqual(metadata.get('shots'), 1000)
+
+    def test_adaptive_shots_parallel_batches(self):
+        """Test adaptive shot batches are executed by several threads"""
+        circuit, noise_model = self.noisy_bell_circuit()
+        shots = 100000
+        qobj = assemble([circuit], self.SIMULATOR, shots=shots,
+                        seed_simulator=1)
+        backend_options = self.BACKEND_OPTS.copy()
+        backend_options['adaptive_shots'] = True
+        backend_options['adaptive_shots_target_error'] = 0.01
+        backend_options['adaptive_shots_batch_size'] = 100
+        backend_options['_parallel_shots'] = 3
+        result = self.SIMULATOR.run(
+            qobj, noise_model=noise_model,
+            backend_options=backend_options).result()
+        self.assertTrue(getattr(result, 'success', False))
+        self.assertEqual(result.results[0].metadata.get('parallel_shots'), 3)
+        metadata = result.results[0].metadata.get('adaptive_shots')
+        self.assertTrue(metadata.get('converged'))
+        self.assertLessEqual(metadata.get('standard_error'), 0.01)
+        executed = metadata.get('shots')
+        self.assertLess(executed, shots)
+        self.assertEqual(executed % 100, 0)
+        self.assertEqual(sum(result.get_counts(0).values()), executed)
@@ -12,10 +12,18 @@
 """
 QasmSimulator Integration Tests
 """
+import json
+import numpy as np
 from test.terra.utils.mock import FakeFailureQasmSimulator, FakeSuccessQasmSimulator
 from qiskit import QuantumRegister, ClassicalRegister, QuantumCircuit
 from qiskit.compiler import transpile, assemble
 from qiskit.providers.aer import AerError
+from qiskit.providers.aer.backends.aerbackend import AerJSONEncoder
+from qiskit.providers.aer.backends.controller_wrappers import qasm_controller_execute
+from qiskit.providers.aer.backends.controller_wrappers import qasm_controller_execute_json
+from qiskit.providers.aer.noise import NoiseModel
+from qiskit.providers.aer.noise.errors import amplitude_damping_error
+from qiskit.providers.aer.noise.errors import ReadoutError
 
 
 class QasmBasicsTests:
@@ -42,3 +50,52 @@ class QasmBasicsTests:
         qobj = assemble(quantum_circuit)
         job = mocked_backend.run(qobj)
         self.assertRaises(AerError, job.result)
+
+    def test_python_qobj_matches_json_qobj(self):
+        """Test a qobj dict is converted to the same ops as its JSON."""
+        # Matrix params and Kraus noise matrices are numpy arrays
+        unitary = np.array([[1, 1j], [1, -1j]]) / np.sqrt(2)
+        noise_model = NoiseModel()
+        noise_model.add_all_qubit_quantum_error(
+            amplitude_damping_error(0.3), ['x'])
+        noise_model.add_all_qubit_readout_error(
+            ReadoutError([[0.9, 0.1], [0.2, 0.8]]))
+        instructions = [
+            {'name': 'h', 'qubits': [0]},
+            {'name': 'unitary', 'qubits': [1], 'params': [unitary]},
+            {'name': 'x', 'qubits': [2]},
+            {'name': 'measure', 'qubits': [0], 'memory': [0], 'register': [0]},
+            {'name': 'bfunc', 'mask': '0x1', 'relation': '==', 'val': '0x1',
+             'register': 3},
+            {'name': 'x', 'qubits': [1], 'conditional': 3},
+            {'name': 'snapshot', 'type': 'statevector', 'label': 'sv',
+             'qubits': [0, 1, 2]},
+            {'name': 'measure', 'qubits': [1, 2], 'memory': [1, 2]}
+        ]
+        qobj = {
+            'qobj_id': 'python_qobj', 'schema_version': '1.1.0', 'type': 'QASM',
+            'header': {}, 'config': {
+                'shots': 100, 'memory': True, 'seed_simulator': 7,
+                'method': 'statevector', 'noise_model': noise_model.to_dict()},
+            'experiments': [{
+                'header': {'name': 'circuit'},
+                'config': {'n_qubits': 3, 'memory_slots': 3},
+                'instructions': instructions}]
+        }
+        result = qasm_controller_execute(qobj)
+        expected = json.loads(qasm_controller_execute_json(
+            json.dumps(qobj, cls=AerJSONEncoder)))
+        self.assertTrue(result['success'])
+        self.assertTrue(expected['success'])
+        data = result['results'][0]['data']
+        expected_data = expected['results'][0]['data']
+        self.assertEqual(data['counts'], expected_data['counts'])
+        self.assertEqual(data['memory'], expected_data['memory'])
+        # JSON complex numbers are [real, imag] pairs
+        statevectors = data['snapshots']['statevector']['sv']
+        expected_statevectors = expected_data['snapshots']['statevector']['sv']
+        self.assertEqual(len(statevectors), len(expected_statevectors))
+        for vec, expected_vec in zip(statevectors, expected_statevectors):
+            expected_vec = np.array(expected_vec)
+            np.testing.assert_allclose(
+                np.array(vec), expected_vec[:, 0] + 1j * expected_vec[:, 1])
@@ -0,0 +1,108 @@
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2018, 2019, 2020.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+
+"""
+QasmSimulator Integration Tests
+"""
+
+from qiskit import QuantumCircuit
+from qiskit.compiler import assemble
+from qiskit.providers.aer import QasmSimulator
+from qiskit.providers.aer.noise import NoiseModel
+from qiskit.providers.aer.noise.errors import pauli_error
+from qiskit.providers.aer.noise.errors import reset_error
+
+
+class QasmBatchedShotsTests:
+    """QasmSimulator batched noisy shots tests."""
+
+    SIMULATOR = QasmSimulator()
+    BACKEND_OPTS = {}
+
+    def noisy_circuit(self):
+        """Noisy circuit with outcome probabilities {00: 0.1, 11: 0.9}."""
+        circuit = QuantumCircuit(2, 2)
+        circuit.x(0)
+        circuit.cx(0, 1)
+        circuit.measure([0, 1], [0, 1])
+        noise_model = NoiseModel()
+        noise_model.add_all_qubit_quantum_error(
+            pauli_error([('X', 0.1), ('I', 0.9)]), ['x'])
+        return circuit, noise_model
+
+    def test_batched_shots(self):
+        """Test noisy shots executed in batches"""
+        circuit, noise_model = self.noisy_circuit()
+        shots = 4000
+        qobj = assemble([circuit], self.SIMULATOR, shots=shots,
+                        seed_simulator=1)
+        # Disable sparse noise sampling which takes precedence over batches
+        backend_options = self.BACKEND_OPTS.copy()
+        backend_options['batched_shots'] = 64
+        backend_options['sparse_noise_threshold'] = 0
+        result = self.SIMULATOR.run(
+            qobj, noise_model=noise_model,
+            backend_options=backend_options).result()
+        self.assertTrue(getattr(result, 'success', False))
+        targets = [{'0x0': 0.1 * shots, '0x3': 0.9 * shots}]
+        self.compare_counts(result, [circuit], targets, delta=0.05 * shots)
+        method = self.BACKEND_OPTS.get('method', 'automatic')
+        if method == 'statevector':
+            metadata = result.results[0].metadata
+            self.assertEqual(metadata.get('batched_shots'), 64)
+
+    def test_batched_shots_mixed_errors(self):
+        """Test batched shots with gate errors and non-unitary errors"""
+        circuit = QuantumCircuit(2, 2)
+        circuit.x(0)
+        circuit.x(1)
+        circuit.measure([0, 1], [0, 1])
+        # Pauli errors are applied in the batch while reset errors update
+        # single shots out of the batch
+        noise_model = NoiseModel()
+        noise_model.add_quantum_error(
+            pauli_error([('X', 0.1), ('I', 0.9)]), ['x'], [0])
+        noise_model.add_quantum_error(reset_error(0.2), ['x'], [1])
+        shots = 4000
+        qobj = assemble([circuit], self.SIMULATOR, shots=shots,
+                        seed_simulator=1)
+        backend_options = self.BACKEND_OPTS.copy()
+        backend_options['batched_shots'] = 64
+        backend_options['sparse_noise_threshold'] = 0
+        result = self.SIMULATOR.run(
+            qobj, noise_model=noise_model,
+            backend_options=backend_options).result()
+        self.assertTrue(getattr(result, 'success', False))
+        targets = [{'0x0': 0.02 * shots, '0x1': 0.18 * shots,
+                    '0x2': 0.08 * shots, '0x3': 0.72 * shots}]
+        self.compare_counts(result, [circuit], targets, delta=0.05 * shots)
+        method = self.BACKEND_OPTS.get('method', 'automatic')
+        if method == 'statevector':
+            metadata = result.results[0].metadata
+            self.assertEqual(metadata.get('batched_shots'), 64)
+
+    def test_batched_shots_disabled(self):
+        """Test noisy shots are executed one at a time by default"""
+        circuit, noise_model = self.noisy_circuit()
+        shots = 4000
+        qobj = assemble([circuit], self.SIMULATOR, shots=shots,
+                        seed_simulator=1)
+        backend_options = self.BACKEND_OPTS.copy()
+        backend_options['sparse_noise_threshold'] = 0
+        result = self.SIMULATOR.run(
+            qobj, noise_model=noise_model,
+            backend_options=backend_options).result()
+        self.assertTrue(getattr(result, 'success', False))
+        targets = [{'0x0': 0.1 * shots, '0x3': 0.9 * shots}]
+        self.compare_counts(result, [circuit], targets, delta=0.05 * shots)
+        metadata = result.results[0].metadata
+        self.assertNotIn('batched_shots', metadata)
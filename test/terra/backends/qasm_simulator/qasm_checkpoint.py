@@ -0,0 +1,104 @@
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2018, 2019, 2020.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+
+"""
+QasmSimulator Integration Tests
+"""
+
+import glob
+import multiprocessing
+import os
+import tempfile
+import time
+
+from qiskit import QuantumCircuit
+from qiskit.compiler import assemble
+from qiskit.providers.aer import QasmSimulator
+from qiskit.providers.aer.noise import NoiseModel
+from qiskit.providers.aer.noise.errors import pauli_error
+from qiskit.providers.aer.extensions.snapshot_expectation_value import SnapshotExpectationValue
+
+
+def run_qobj(qobj, noise_model, backend_options):
+    """Run a qobj in a process that is terminated by the test."""
+    QasmSimulator().run(qobj, noise_model=noise_model,
+                        backend_options=backend_options).result()
+
+
+class QasmCheckpointTests:
+    """QasmSimulator checkpointing tests."""
+
+    SIMULATOR = QasmSimulator()
+    BACKEND_OPTS = {}
+
+    def noisy_circuit(self):
+        """Noisy circuit with an expectation value snapshot."""
+        num_qubits = 8
+        circuit = QuantumCircuit(num_qubits, num_qubits)
+        for layer in range(6):
+            for qubit in range(num_qubits):
+                circuit.u3(0.3 + 0.1 * qubit, 0.2 * layer, 0.1, qubit)
+            for qubit in range(num_qubits - 1):
+                circuit.cx(qubit, qubit + 1)
+        circuit.append(SnapshotExpectationValue('z', [[1, 'Z']]), [0])
+        circuit.measure(range(num_qubits), range(num_qubits))
+        noise_model = NoiseModel()
+        noise_model.add_all_qubit_quantum_error(
+            pauli_error([('X', 0.03), ('I', 0.97)]), ['cx'])
+        return circuit, noise_model
+
+    def test_checkpoint_resume(self):
+        """Test a resumed run matches an uninterrupted run"""
+        circuit, noise_model = self.noisy_circuit()
+        qobj = assemble([circuit], self.SIMULATOR, shots=3000, memory=True,
+                        seed_simulator=11)
+        backend_options = self.BACKEND_OPTS.copy()
+        backend_options['max_parallel_threads'] = 1
+        backend_options['checkpoint_period'] = 0
+
+        with tempfile.TemporaryDirectory() as directory:
+            backend_options['checkpoint_directory'] = directory
+            expected = self.SIMULATOR.run(
+                qobj, noise_model=noise_model,
+                backend_options=backend_options).result()
+            self.assertEqual(os.listdir(directory), [])
+
+        with tempfile.TemporaryDirectory() as directory:
+            backend_options['checkpoint_directory'] = directory
+            # Terminate a run once it has saved checkpoints of some shots
+            process = multiprocessing.Process(
+                target=run_qobj, args=(qobj, noise_model, backend_options))
+            process.start()
+            checkpoints = os.path.join(directory, 'checkpoint_*.bin')
+            while process.is_alive() and not glob.glob(checkpoints):
+                time.sleep(0.01)
+            time.sleep(0.2)
+            process.terminate()
+            process.join()
+            self.assertEqual(len(glob.glob(checkpoints)), 1)
+
+            result = self.SIMULATOR.run(
+                qobj, noise_model=noise_model,
+                backend_options=backend_options).result()
+            self.assertTrue(getattr(result, 'success', False))
+            self.assertEqual(os.listdir(directory), [])
+
+        self.assertEqual(result.get_counts(0), expected.get_counts(0))
+        self.assertEqual(result.get_memory(0), expected.get_memory(0))
+        self.assertEqual(len(result.get_memory(0)), 3000)
+        data = result.data(0)['snapshots']['expectation_value']['z']
+        expected_data = expected.data(0)['snapshots']['expectation_value']['z']
+        self.assertEqual(data, expected_data)
+        metadata = result.results[0].metadata
+        expected_metadata = expected.results[0].metadata
+        for key in ['method', 'measure_sampling', 'noise_streaming']:
+            self.assertEqual(metadata.get(key), expected_metadata.get(key))
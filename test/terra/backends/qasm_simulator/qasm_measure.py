@@ -13,7 +13,13 @@
 QasmSimulator Integration Tests
 """
 
+import json
+import os
+import tempfile
+import numpy as np
+
 from test.terra.reference import ref_measure
+from qiskit import QuantumCircuit
 from qiskit.compiler import assemble
 from qiskit.providers.aer import QasmSimulator
 from qiskit.providers.aer.noise import NoiseModel
@@ -59,6 +65,70 @@ class QasmMeasureTests:
         self.compare_memory(result, circuits, target_memory)
         self.compare_result_metadata(result, circuits, "measure_sampling", False)
 
+    def test_measure_deterministic_with_shot_sink(self):
+        """Test QasmSimulator measure memory streamed to a shot sink"""
+        shots = 100
+        circuits = ref_measure.measure_circuits_deterministic(
+            allow_sampling=False)
+        target_counts = ref_measure.measure_counts_deterministic(shots)
+        target_memory = ref_measure.measure_memory_deterministic(shots)
+        qobj = assemble(circuits, self.SIMULATOR, shots=shots, memory=True)
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            path = os.path.join(tmp_dir, 'shots.ndjson')
+            backend_opts = self.BACKEND_OPTS.copy()
+            backend_opts['shot_sink'] = path
+            backend_opts['shot_sink_chunk'] = 30
+            result = self.SIMULATOR.run(
+                qobj, backend_options=backend_opts).result()
+            self.assertTrue(getattr(result, 'success', False))
+            self.compare_counts(result, circuits, target_counts, delta=0)
+            self.assertEqual(result.metadata['shot_sink']['path'], path)
+            with open(path) as sink:
+                records = [json.loads(line) for line in sink]
+        # Per-shot memory is only returned in the shot sink
+        for res in result.results:
+            self.assertNotIn('memory', res.data.to_dict())
+        records.sort(key=lambda rec: (rec['experiment'], rec['first_shot']))
+        memory = [[] for _ in circuits]
+        for rec in records:
+            self.assertEqual(len(rec['memory']), rec['shots'])
+            memory[rec['experiment']] += rec['memory']
+        self.assertEqual(memory, target_memory)
+
+    def test_measure_packed_memory(self):
+        """Test QasmSimulator packed memory matches the hex memory"""
+        shots = 100
+        circuits = ref_measure.measure_circuits_nondeterministic(
+            allow_sampling=True)
+        # Memory of more than 8 bits is packed into several bytes per shot
+        circuit = QuantumCircuit(10, 10)
+        circuit.h(range(10))
+        circuit.measure(range(10), range(10))
+        circuits.append(circuit)
+        qobj = assemble(circuits, self.SIMULATOR, shots=shots, memory=True)
+
+        results = []
+        for packed in [True, False]:
+            backend_opts = self.BACKEND_OPTS.copy()
+            backend_opts['seed_simulator'] = 1234
+            backend_opts['packed_memory'] = packed
+            result = self.SIMULATOR.run(
+                qobj, backend_options=backend_opts).result()
+            self.assertTrue(getattr(result, 'success', False))
+            results.append(result)
+
+        for circuit in circuits:
+            packed = results[0].data(circuit)['memory']
+            memory = results[1].data(circuit)['memory']
+            num_bytes = (circuit.num_clbits + 7) // 8
+            self.assertIsInstance(packed, np.ndarray)
+            self.assertEqual(packed.dtype, np.uint8)
+            self.assertEqual(packed.shape, (shots, num_bytes))
+            # Bit j of the memory of a shot is bit j % 8 of byte j // 8
+            values = [sum(int(byte) << (8 * j) for j, byte in enumerate(row))
+                      for row in packed]
+            self.assertEqual(values, [int(hex_val, 16) for hex_val in memory])
+
     def test_measure_nondeterministic_with_sampling(self):
         """Test QasmSimulator measure with non-deterministic counts with sampling"""
         shots = 2000
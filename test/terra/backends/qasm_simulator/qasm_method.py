@@ -15,6 +15,7 @@ QasmSimulator Integration Tests
 
 from test.terra.reference import ref_2q_clifford
 from test.terra.reference import ref_non_clifford
+from qiskit import QuantumCircuit
 from qiskit.compiler import assemble
 from qiskit.providers.aer import QasmSimulator
 from qiskit.providers.aer import AerError
@@ -329,3 +330,34 @@ class QasmMethodTests:
                 target_method = method
             self.compare_result_metadata(result, circuits, 'method',
                                          target_method)
+
+    # ---------------------------------------------------------------------
+    # Test large shallow circuits
+    # ---------------------------------------------------------------------
+    def test_backend_method_large_shallow_circuit(self):
+        """Test matrix_product_state method is used for shallow circuit"""
+        method = self.BACKEND_OPTS.get('method', 'automatic')
+        if method != 'automatic':
+            return
+        # Test circuit
+        shots = 100
+        num_qubits = 60
+        circuit = QuantumCircuit(num_qubits, num_qubits)
+        for layer in range(3):
+            for qubit in range(num_qubits):
+                circuit.t(qubit)
+                circuit.h(qubit)
+            for qubit in range(layer % 2, num_qubits - 1, 2):
+                circuit.cx(qubit, qubit + 1)
+        circuit.measure(range(num_qubits), range(num_qubits))
+        circuits = [circuit]
+        qobj = assemble(circuits, self.SIMULATOR, shots=shots)
+
+        result = self.SIMULATOR.run(
+            qobj, backend_options=self.BACKEND_OPTS).result()
+        success = getattr(result, 'success', False)
+        self.assertTrue(success)
+        self.compare_result_metadata(result, circuits, 'method',
+                                     'matrix_product_state')
+        metadata = result.results[0].metadata
+        self.assertIn('matrix_product_state', metadata['method_estimates'])
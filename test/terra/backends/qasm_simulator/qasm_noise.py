@@ -18,8 +18,12 @@ from test.terra.reference import ref_pauli_noise
 from test.terra.reference import ref_reset_noise
 from test.terra.reference import ref_kraus_noise
 
+from qiskit import QuantumCircuit
 from qiskit.compiler import assemble
 from qiskit.providers.aer import QasmSimulator
+from qiskit.providers.aer.noise import NoiseModel
+from qiskit.providers.aer.noise.errors import pauli_error
+from qiskit.providers.aer.extensions.snapshot_expectation_value import SnapshotExpectationValue
 
 
 class QasmReadoutNoiseTests:
@@ -47,6 +51,74 @@ class QasmReadoutNoiseTests:
             self.assertTrue(getattr(result, 'success', False))
             self.compare_counts(result, [circuit], [target], delta=0.05 * shots)
 
+    def test_readout_noise_with_memory(self):
+        """Test simulation with classical readout error noise model
+        returning the memory of each shot."""
+        shots = 2000
+        circuits = ref_readout_noise.readout_error_circuits()
+        noise_models = ref_readout_noise.readout_error_noise_models()
+        targets = ref_readout_noise.readout_error_counts(shots)
+
+        for circuit, noise_model, target in zip(circuits, noise_models,
+                                                targets):
+            qobj = assemble(circuit, self.SIMULATOR, shots=shots, memory=True)
+            result = self.SIMULATOR.run(
+                qobj,
+                backend_options=self.BACKEND_OPTS,
+                noise_model=noise_model).result()
+            self.assertTrue(getattr(result, 'success', False))
+            self.assertEqual(len(result.get_memory(circuit)), shots)
+            self.compare_counts(result, [circuit], [target], delta=0.05 * shots)
+
+    def test_readout_noise_probabilities(self):
+        """Test simulation with classical readout error noise model
+        returning the exact outcome probabilities."""
+        shots = 2000
+        circuits = ref_readout_noise.readout_error_circuits()
+        noise_models = ref_readout_noise.readout_error_noise_models()
+        targets = ref_readout_noise.readout_error_counts(shots)
+        probabilities = ref_readout_noise.readout_error_probabilities()
+        backend_opts = self.BACKEND_OPTS.copy()
+        backend_opts['probabilities_with_readout'] = True
+
+        for circuit, noise_model, target, probs in zip(
+                circuits, noise_models, targets, probabilities):
+            qobj = assemble(circuit, self.SIMULATOR, shots=shots)
+            result = self.SIMULATOR.run(
+                qobj,
+                backend_options=backend_opts,
+                noise_model=noise_model).result()
+            self.assertTrue(getattr(result, 'success', False))
+            self.compare_counts(result, [circuit], [target], delta=0.05 * shots)
+            method = result.results[0].metadata.get('method')
+            if method in ['statevector', 'density_matrix']:
+                self.assertDictAlmostEqual(
+                    result.data(circuit)['probabilities_with_readout'],
+                    probs, delta=1e-10)
+
+    def test_readout_noise_probabilities_threshold(self):
+        """Test readout error noise model sampling each shot when the
+        measured qubits exceed the probabilities threshold."""
+        shots = 2000
+        circuits = ref_readout_noise.readout_error_circuits()
+        noise_models = ref_readout_noise.readout_error_noise_models()
+        targets = ref_readout_noise.readout_error_counts(shots)
+        backend_opts = self.BACKEND_OPTS.copy()
+        backend_opts['probabilities_with_readout'] = True
+        backend_opts['probabilities_with_readout_threshold'] = 0
+
+        for circuit, noise_model, target in zip(circuits, noise_models,
+                                                targets):
+            qobj = assemble(circuit, self.SIMULATOR, shots=shots)
+            result = self.SIMULATOR.run(
+                qobj,
+                backend_options=backend_opts,
+                noise_model=noise_model).result()
+            self.assertTrue(getattr(result, 'success', False))
+            self.compare_counts(result, [circuit], [target], delta=0.05 * shots)
+            self.assertNotIn('probabilities_with_readout',
+                             result.data(circuit))
+
 
 class QasmPauliNoiseTests:
     """QasmSimulator pauli error noise model tests."""
@@ -71,6 +143,127 @@ class QasmPauliNoiseTests:
             self.assertTrue(getattr(result, 'success', False))
             self.compare_counts(result, [circuit], [target], delta=0.05 * shots)
 
+    def test_pauli_gate_noise_without_sparse_sampling(self):
+        """Test simulation with Pauli gate error noise model sampled per shot."""
+        shots = 2000
+        circuits = ref_pauli_noise.pauli_gate_error_circuits()
+        noise_models = ref_pauli_noise.pauli_gate_error_noise_models()
+        targets = ref_pauli_noise.pauli_gate_error_counts(shots)
+        backend_options = self.BACKEND_OPTS.copy()
+        backend_options['sparse_noise_threshold'] = 0
+
+        for circuit, noise_model, target in zip(circuits, noise_models,
+                                                targets):
+            qobj = assemble(circuit, self.SIMULATOR, shots=shots)
+            result = self.SIMULATOR.run(
+                qobj,
+                backend_options=backend_options,
+                noise_model=noise_model).result()
+            self.assertTrue(getattr(result, 'success', False))
+            self.assertNotIn('sparse_noise_patterns',
+                             result.results[0].metadata)
+            self.compare_counts(result, [circuit], [target], delta=0.05 * shots)
+
+    def test_pauli_gate_noise_snapshot_with_sparse_sampling(self):
+        """Test noisy snapshots match with and without sparse sampling."""
+        shots = 4000
+        circuit = QuantumCircuit(1, 1)
+        circuit.x(0)
+        circuit.append(SnapshotExpectationValue('z', [[1, 'Z']]), [0])
+        circuit.measure(0, 0)
+        noise_model = NoiseModel()
+        noise_model.add_all_qubit_quantum_error(
+            pauli_error([('X', 0.3), ('I', 0.7)]), ['x'])
+        qobj = assemble(circuit, self.SIMULATOR, shots=shots)
+
+        values = []
+        for threshold in [4, 0]:
+            backend_options = self.BACKEND_OPTS.copy()
+            backend_options['sparse_noise_threshold'] = threshold
+            result = self.SIMULATOR.run(
+                qobj,
+                backend_options=backend_options,
+                noise_model=noise_model).result()
+            self.assertTrue(getattr(result, 'success', False))
+            self.assertNotIn('sparse_noise_patterns',
+                             result.results[0].metadata)
+            snapshot = result.data(0)['snapshots']['expectation_value']['z']
+            values.append(snapshot[0]['value'])
+        # <Z> = 0.3 - 0.7 = -0.4 averaged over all shots
+        for value in values:
+            self.assertAlmostEqual(value, -0.4, delta=0.05)
+        self.assertAlmostEqual(values[0], values[1], delta=0.05)
+
+    def test_pauli_gate_noise_without_sparse_noise_cache(self):
+        """Test simulation with Pauli gate error noise model sampled
+        sparsely without caching states of the error patterns."""
+        shots = 2000
+        circuits = ref_pauli_noise.pauli_gate_error_circuits()
+        noise_models = ref_pauli_noise.pauli_gate_error_noise_models()
+        targets = ref_pauli_noise.pauli_gate_error_counts(shots)
+        backend_options = self.BACKEND_OPTS.copy()
+        backend_options['sparse_noise_cache_mb'] = 0
+
+        for circuit, noise_model, target in zip(circuits, noise_models,
+                                                targets):
+            qobj = assemble(circuit, self.SIMULATOR, shots=shots)
+            result = self.SIMULATOR.run(
+                qobj,
+                backend_options=backend_options,
+                noise_model=noise_model).result()
+            self.assertTrue(getattr(result, 'success', False))
+            self.assertNotIn('sparse_noise_cache_hits',
+                             result.results[0].metadata)
+            self.compare_counts(result, [circuit], [target], delta=0.05 * shots)
+
+    def test_pauli_gate_noise_with_sparse_noise_cache(self):
+        """Test simulation with Pauli gate error noise model sampled
+        sparsely from cached states of shared error patterns."""
+        shots = 2000
+        # 25% all-qubit Pauli error on "id" gates: the pattern with errors
+        # on both gates resumes from the cached state of the first error
+        circuit = ref_pauli_noise.pauli_gate_error_circuits()[1]
+        noise_model = ref_pauli_noise.pauli_gate_error_noise_models()[1]
+        target = ref_pauli_noise.pauli_gate_error_counts(shots)[1]
+
+        qobj = assemble(circuit, self.SIMULATOR, shots=shots)
+        result = self.SIMULATOR.run(
+            qobj,
+            backend_options=self.BACKEND_OPTS,
+            noise_model=noise_model).result()
+        self.assertTrue(getattr(result, 'success', False))
+        self.compare_counts(result, [circuit], [target], delta=0.05 * shots)
+        metadata = result.results[0].metadata
+        if metadata.get('method') == 'statevector':
+            self.assertGreater(metadata.get('sparse_noise_cache_hits', 0), 0)
+
+    def test_pauli_gate_noise_pauli_frames(self):
+        """Test simulation with Pauli gate error noise model with and
+        without Pauli frame simulation."""
+        shots = 2000
+        circuits = ref_pauli_noise.pauli_gate_error_circuits()
+        noise_models = ref_pauli_noise.pauli_gate_error_noise_models()
+        targets = ref_pauli_noise.pauli_gate_error_counts(shots)
+
+        for pauli_frames in [True, False]:
+            backend_options = self.BACKEND_OPTS.copy()
+            backend_options['pauli_frame_simulation'] = pauli_frames
+            for circuit, noise_model, target in zip(circuits, noise_models,
+                                                    targets):
+                qobj = assemble(circuit, self.SIMULATOR, shots=shots)
+                result = self.SIMULATOR.run(
+                    qobj,
+                    backend_options=backend_options,
+                    noise_model=noise_model).result()
+                self.assertTrue(getattr(result, 'success', False))
+                # Pauli frames are only used by the stabilizer method
+                metadata = result.results[0].metadata
+                stabilizer = metadata.get('method') == 'stabilizer'
+                self.assertEqual(metadata.get('pauli_frame_simulation', False),
+                                 pauli_frames and stabilizer)
+                self.compare_counts(result, [circuit], [target],
+                                    delta=0.05 * shots)
+
     def test_pauli_reset_noise(self):
         """Test simulation with Pauli reset error noise model."""
         shots = 2000
@@ -152,3 +345,78 @@ class QasmKrausNoiseTests:
                 noise_model=noise_model).result()
             self.assertTrue(getattr(result, 'success', False))
             self.compare_counts(result, [circuit], [target], delta=0.05 * shots)
+
+    def test_kraus_gate_noise_streaming(self):
+        """Test Kraus gate error noise streamed to the statevector."""
+        shots = 2000
+        circuits = ref_kraus_noise.kraus_gate_error_circuits()
+        noise_models = ref_kraus_noise.kraus_gate_error_noise_models()
+        targets = ref_kraus_noise.kraus_gate_error_counts(shots)
+
+        for circuit, noise_model, target in zip(circuits, noise_models,
+                                                targets):
+            qobj = assemble(circuit, self.SIMULATOR, shots=shots)
+            counts = []
+            for streaming in [True, False]:
+                backend_options = self.BACKEND_OPTS.copy()
+                backend_options['noise_streaming'] = streaming
+                backend_options['sparse_noise_threshold'] = 0
+                result = self.SIMULATOR.run(
+                    qobj,
+                    backend_options=backend_options,
+                    noise_model=noise_model).result()
+                self.assertTrue(getattr(result, 'success', False))
+                self.compare_counts(result, [circuit], [target],
+                                    delta=0.05 * shots)
+                # Only noisy statevector shots are streamed
+                metadata = result.results[0].metadata
+                streamed = metadata.get('method') == 'statevector' and streaming
+                self.assertEqual(metadata.get('noise_streaming', False),
+                                 streamed)
+                counts.append(result.get_counts(circuit))
+            # Streamed and per-shot noisy circuits sample the same distribution
+            self.assertDictAlmostEqual(counts[0], counts[1],
+                                       delta=0.05 * shots)
+
+    def test_thermal_relaxation_gate_noise(self):
+        """Test simulation with native thermal relaxation gate error noise model."""
+        shots = 2000
+        circuits = ref_kraus_noise.thermal_relaxation_gate_error_circuits()
+        noise_models = ref_kraus_noise.thermal_relaxation_gate_error_noise_models()
+        targets = ref_kraus_noise.thermal_relaxation_gate_error_counts(shots)
+
+        for circuit, noise_model, target in zip(circuits, noise_models,
+                                                targets):
+            qobj = assemble(circuit, self.SIMULATOR, shots=shots)
+            result = self.SIMULATOR.run(
+                qobj,
+                backend_options=self.BACKEND_OPTS,
+                noise_model=noise_model).result()
+            self.assertTrue(getattr(result, 'success', False))
+            self.compare_counts(result, [circuit], [target], delta=0.05 * shots)
+
+    def test_fused_gate_noise(self):
+        """Test simulation with Kraus, mixed unitary and Pauli gate errors
+        that are fused into superoperators by the density matrix method."""
+        shots = 4000
+        circuits = ref_kraus_noise.fused_gate_error_circuits()
+        noise_models = ref_kraus_noise.fused_gate_error_noise_models()
+        targets = ref_kraus_noise.fused_gate_error_counts(shots)
+        probabilities = ref_kraus_noise.fused_gate_error_probabilities()
+
+        for circuit, noise_model, target, probs in zip(
+                circuits, noise_models, targets, probabilities):
+            qobj = assemble(circuit, self.SIMULATOR, shots=shots)
+            result = self.SIMULATOR.run(
+                qobj,
+                backend_options=self.BACKEND_OPTS,
+                noise_model=noise_model).result()
+            self.assertTrue(getattr(result, 'success', False))
+            self.compare_counts(result, [circuit], [target], delta=0.05 * shots)
+            # The density matrix method applies the fused superoperators
+            # exactly
+            method = result.results[0].metadata.get('method', '')
+            if method.startswith('density_matrix'):
+                snapshots = result.data(circuit)['snapshots']['probabilities']
+                self.assertDictAlmostEqual(snapshots['probs'][0]['value'],
+                                           probs, delta=1e-10)
@@ -16,11 +16,14 @@ QasmSimulator Integration Tests for Snapshot instructions
 import logging
 import numpy as np
 
+from qiskit import QuantumCircuit
 from qiskit.compiler import assemble
 from qiskit.quantum_info.operators import Pauli
 from qiskit.providers.aer import QasmSimulator
 from qiskit.providers.aer import AerError
 
+from qiskit.providers.aer.extensions.snapshot import Snapshot
+
 from test.terra.reference.ref_snapshot_state import (
     snapshot_state_circuits_deterministic, snapshot_state_counts_deterministic,
     snapshot_state_pre_measure_statevector_deterministic,
@@ -357,14 +360,46 @@ class QasmSnapshotDensityMatrixTests:
         # Check snapshot entry exists in data
         snaps = data.get("snapshots", {}).get("density_matrix",
                                               {}).get(label, [])
-        # Convert nested lists to numpy arrays
+        # Convert nested lists of real and imaginary parts to numpy arrays
         output = {}
         for snap_dict in snaps:
             memory = snap_dict['memory']
             mat = np.array(snap_dict['value'])
-            output[memory] = mat[:, :, 0] + 1j * mat[:, :, 1]
+            if mat.ndim == 3:
+                mat = mat[:, :, 0] + 1j * mat[:, :, 1]
+            output[memory] = mat
         return output
 
+    def test_snapshot_density_matrix_numpy_array(self):
+        """Test snapshot density matrix is a complex numpy array with rows
+        and columns in order"""
+        label = "snap"
+        circuit = QuantumCircuit(2)
+        circuit.h(0)
+        circuit.s(0)
+        circuit.cx(0, 1)
+        circuit.append(Snapshot(label, 'density_matrix', 2), [0, 1])
+        # The off-diagonal entries are conjugates, so swapped rows and
+        # columns would give the conjugate density matrix
+        statevec = np.array([1, 0, 0, 1j]) / np.sqrt(2)
+        target = np.outer(statevec, statevec.conj())
+
+        qobj = assemble(circuit, self.SIMULATOR, shots=1)
+        job = self.SIMULATOR.run(qobj, backend_options=self.BACKEND_OPTS)
+        result = job.result()
+        success = getattr(result, 'success', False)
+        method = self.BACKEND_OPTS.get('method', 'automatic')
+        if method not in QasmSnapshotDensityMatrixTests.SUPPORTED_QASM_METHODS:
+            self.assertFalse(success)
+        else:
+            self.assertTrue(success)
+            snaps = result.data(circuit)['snapshots']['density_matrix'][label]
+            value = snaps[0]['value']
+            self.assertIsInstance(value, np.ndarray)
+            self.assertEqual(value.shape, (4, 4))
+            self.assertAlmostEqual(value[3, 0], 0.5j)
+            self.assertTrue(np.allclose(value, target))
+
     def test_snapshot_density_matrix_pre_measure_det(self):
         """Test snapshot density matrix before deterministic final measurement"""
         shots = 10
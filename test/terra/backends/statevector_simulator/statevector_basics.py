@@ -13,6 +13,8 @@
 StatevectorSimulator Integration Tests
 """
 
+import numpy as np
+
 from test.terra.reference import ref_measure
 from test.terra.reference import ref_reset
 from test.terra.reference import ref_initialize
@@ -22,7 +24,7 @@ from test.terra.reference import ref_2q_clifford
 from test.terra.reference import ref_non_clifford
 from test.terra.reference import ref_unitary_gate
 
-from qiskit import execute
+from qiskit import execute, QuantumCircuit
 from qiskit.compiler import assemble
 from qiskit.providers.aer import StatevectorSimulator
 
@@ -1246,3 +1248,25 @@ class StatevectorSimulatorTests:
         result = job.result()
         self.assertTrue(getattr(result, 'success', False))
         self.compare_statevector(result, circuits, targets)
+
+    # ---------------------------------------------------------------------
+    # Test statevector result format
+    # ---------------------------------------------------------------------
+    def test_statevector_numpy_array(self):
+        """Test the statevector is returned as a complex numpy array"""
+        circuit = QuantumCircuit(2)
+        circuit.h(0)
+        circuit.s(0)
+        circuit.cx(0, 1)
+        target = np.array([1, 0, 0, 1j]) / np.sqrt(2)
+        job = execute(circuit,
+                      self.SIMULATOR,
+                      shots=1,
+                      basis_gates=['h', 's', 'cx'],
+                      backend_options=self.BACKEND_OPTS)
+        result = job.result()
+        self.assertTrue(getattr(result, 'success', False))
+        value = result.data(circuit)['statevector']
+        self.assertIsInstance(value, np.ndarray)
+        self.assertEqual(value.shape, (4,))
+        self.assertTrue(np.allclose(value, target))
@@ -56,6 +56,9 @@ from test.terra.backends.qasm_simulator.qasm_fusion import QasmFusionTests
 from test.terra.backends.qasm_simulator.qasm_delay_measure import QasmDelayMeasureTests
 from test.terra.backends.qasm_simulator.qasm_truncate import QasmQubitsTruncateTests
 from test.terra.backends.qasm_simulator.qasm_basics import QasmBasicsTests
+from test.terra.backends.qasm_simulator.qasm_adaptive_shots import QasmAdaptiveShotsTests
+from test.terra.backends.qasm_simulator.qasm_batched_shots import QasmBatchedShotsTests
+from test.terra.backends.qasm_simulator.qasm_checkpoint import QasmCheckpointTests
 
 
 class StatevectorTests(
@@ -72,7 +75,8 @@ class StatevectorTests(
         QasmResetNoiseTests, QasmKrausNoiseTests, QasmBasicsTests,
         QasmSnapshotStatevectorTests, QasmSnapshotDensityMatrixTests,
         QasmSnapshotProbabilitiesTests, QasmSnapshotExpValPauliTests,
-        QasmSnapshotExpValMatrixTests, QasmSnapshotStabilizerTests):
+        QasmSnapshotExpValMatrixTests, QasmSnapshotStabilizerTests,
+        QasmAdaptiveShotsTests, QasmBatchedShotsTests, QasmCheckpointTests):
     """Container class of statevector method tests."""
     pass
 
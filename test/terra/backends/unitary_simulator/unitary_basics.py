@@ -14,13 +14,14 @@ UnitarySimulator Integration Tests
 """
 
 import unittest
+import numpy as np
 from test.terra import common
 from test.terra.reference import ref_1q_clifford
 from test.terra.reference import ref_2q_clifford
 from test.terra.reference import ref_non_clifford
 from test.terra.reference import ref_unitary_gate
 
-from qiskit import execute
+from qiskit import execute, QuantumCircuit
 from qiskit.providers.aer import UnitarySimulator
 
 
@@ -1178,3 +1179,32 @@ class UnitarySimulatorTests:
         result = job.result()
         self.assertTrue(getattr(result, 'success', False))
         self.compare_unitary(result, circuits, targets)
+
+    # ---------------------------------------------------------------------
+    # Test unitary result format
+    # ---------------------------------------------------------------------
+    def test_unitary_numpy_array(self):
+        """Test the unitary is returned as a complex numpy array with rows
+        and columns in order"""
+        circuit = QuantumCircuit(2)
+        circuit.h(0)
+        circuit.s(0)
+        circuit.cx(0, 1)
+        # The unitary is not symmetric, so swapped rows and columns would
+        # give its transpose
+        mat_h = np.array([[1, 1], [1, -1]]) / np.sqrt(2)
+        mat_s = np.diag([1, 1j])
+        mat_cx = np.array([[1, 0, 0, 0], [0, 0, 0, 1], [0, 0, 1, 0],
+                           [0, 1, 0, 0]])
+        target = mat_cx.dot(np.kron(np.eye(2), mat_s.dot(mat_h)))
+        job = execute(circuit,
+                      self.SIMULATOR,
+                      shots=1,
+                      basis_gates=['h', 's', 'cx'],
+                      backend_options=self.BACKEND_OPTS)
+        result = job.result()
+        self.assertTrue(getattr(result, 'success', False))
+        value = result.data(circuit)['unitary']
+        self.assertIsInstance(value, np.ndarray)
+        self.assertEqual(value.shape, (4, 4))
+        self.assertTrue(np.allclose(value, target))
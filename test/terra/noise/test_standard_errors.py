@@ -19,6 +19,7 @@ from test.terra import common
 import numpy as np
 
 from qiskit.quantum_info.operators.pauli import Pauli
+from qiskit.quantum_info.operators.channel import Choi, Kraus, SuperOp
 from qiskit.providers.aer.noise.noiseerror import NoiseError
 from qiskit.providers.aer.noise.errors.errorutils import standard_gate_unitary
 from qiskit.providers.aer.noise.errors.standard_errors import kraus_error
@@ -670,13 +671,24 @@ class TestNoise(common.QiskitAerTestCase):
         self.assertEqual(targets, [], msg="relaxation circuits")
 
     def test_thermal_relaxation_error_kraus(self):
-        """Test non-kraus instructions return for t2 < t1"""
+        """Test native instruction return for t2 > t1"""
         t1, t2, time, p1 = (1, 2, 1, 0.3)
         error = thermal_relaxation_error(t1, t2, time, p1)
         circ, p = error.error_term(0)
         self.assertEqual(p, 1)
-        self.assertEqual(circ[0]['name'], 'kraus')
-        self.assertEqual(circ[0]['qubits'], [0])
+        self.assertEqual(circ, [{'name': 'thermal_relaxation', 'qubits': [0],
+                                 'params': [t1, t2, time, p1]}])
+        # The channel and circuit instruction use the equivalent Kraus channel
+        p_reset = 1 - np.exp(-time / t1)
+        exp_t2 = np.exp(-time / t2)
+        target = Choi(
+            np.array([[1 - p1 * p_reset, 0, 0, exp_t2],
+                      [0, p1 * p_reset, 0, 0], [0, 0, (1 - p1) * p_reset, 0],
+                      [exp_t2, 0, 0, 1 - (1 - p1) * p_reset]]))
+        self.assertEqual(error.to_quantumchannel(), SuperOp(target))
+        instruction = error.to_instruction()
+        self.assertEqual(instruction.name, 'kraus')
+        self.assertEqual(SuperOp(Kraus(instruction.params)), SuperOp(target))
 
 
 if __name__ == '__main__':
@@ -14,11 +14,17 @@
 QasmSimulator kraus error NoiseModel integration tests
 """
 
+import numpy as np
+
 from test.terra.utils.utils import list2dict
 
 from qiskit import QuantumRegister, ClassicalRegister, QuantumCircuit
 from qiskit.providers.aer.noise import NoiseModel
 from qiskit.providers.aer.noise.errors.standard_errors import amplitude_damping_error
+from qiskit.providers.aer.noise.errors.standard_errors import mixed_unitary_error
+from qiskit.providers.aer.noise.errors.standard_errors import pauli_error
+from qiskit.providers.aer.noise.errors.standard_errors import thermal_relaxation_error
+from qiskit.providers.aer.extensions.snapshot_probabilities import *
 
 
 # ==========================================================================
@@ -58,6 +64,63 @@ def kraus_gate_error_noise_models():
     return noise_models
 
 
+def thermal_relaxation_gate_error_circuits():
+    """Native thermal relaxation gate error noise model circuits"""
+    circuits = kraus_gate_error_circuits()
+
+    # Ramsey circuit for dephasing of the + state
+    qr = QuantumRegister(1, 'qr')
+    cr = ClassicalRegister(1, 'cr')
+    circuit = QuantumCircuit(qr, cr)
+    circuit.h(qr)  # prepare + state
+    circuit.barrier(qr)
+    circuit.iden(qr)
+    circuit.barrier(qr)
+    circuit.h(qr)
+    circuit.measure(qr, cr)
+    circuits.append(circuit)
+
+    return circuits
+
+
+def thermal_relaxation_gate_error_noise_models():
+    """Native thermal relaxation gate error noise models"""
+    noise_models = []
+
+    # Thermal relaxation error on "id" with the same decay as the
+    # amplitude damping error after 30 gates
+    error = thermal_relaxation_error(30., 40., np.log(4))
+    noise_model = NoiseModel()
+    noise_model.add_all_qubit_quantum_error(error, 'id')
+    noise_models.append(noise_model)
+
+    # Thermal relaxation error on "id" which reduces the coherence of
+    # the qubit to 1/4. T1 decay alone would only reduce it to 0.46
+    t2 = 45.
+    error = thermal_relaxation_error(40., t2, t2 * np.log(4))
+    noise_model = NoiseModel()
+    noise_model.add_all_qubit_quantum_error(error, 'id')
+    noise_models.append(noise_model)
+
+    return noise_models
+
+
+def thermal_relaxation_gate_error_counts(shots, hex_counts=True):
+    """Native thermal relaxation gate error circuits reference counts"""
+    counts_lists = []
+
+    # Same decay as the amplitude damping error
+    counts = [3 * shots / 4, shots / 4, 0, 0]
+    counts_lists.append(counts)
+
+    # P(0) = (1 + 1/4) / 2 after the Ramsey circuit
+    counts = [5 * shots / 8, 3 * shots / 8, 0, 0]
+    counts_lists.append(counts)
+
+    # Convert to counts dict
+    return [list2dict(i, hex_counts) for i in counts_lists]
+
+
 def kraus_gate_error_counts(shots, hex_counts=True):
     """Kraus gate error circuits reference counts"""
     counts_lists = []
@@ -68,3 +131,82 @@ def kraus_gate_error_counts(shots, hex_counts=True):
 
     # Convert to counts dict
     return [list2dict(i, hex_counts) for i in counts_lists]
+
+
+# ==========================================================================
+# Kraus, mixed unitary and Pauli errors fused into superoperators
+# ==========================================================================
+
+def fused_gate_error_circuits():
+    """Circuits of gates whose errors are fused into superoperators.
+
+    The single-qubit gate superoperators act on qubits of the adjacent "cx"
+    superoperator and are merged into it by the density matrix method.
+    """
+    circuits = []
+    qr = QuantumRegister(2, 'qr')
+    cr = ClassicalRegister(2, 'cr')
+
+    # Single-qubit superops before and after a two-qubit superop
+    circuit = QuantumCircuit(qr, cr)
+    circuit.x(qr[0])
+    circuit.cx(qr[0], qr[1])
+    circuit.y(qr[1])
+    circuit.snapshot_probabilities('probs', [0, 1])
+    circuit.measure(qr, cr)
+    circuits.append(circuit)
+
+    # Single-qubit superops on both qubits of a two-qubit superop
+    circuit = QuantumCircuit(qr, cr)
+    circuit.x(qr[0])
+    circuit.x(qr[1])
+    circuit.cx(qr[0], qr[1])
+    circuit.snapshot_probabilities('probs', [0, 1])
+    circuit.measure(qr, cr)
+    circuits.append(circuit)
+
+    return circuits
+
+
+def fused_gate_error_noise_models():
+    """Noise models of Kraus, mixed unitary and Pauli gate errors"""
+    noise_model = NoiseModel()
+    # Amplitude damping error on "x"
+    noise_model.add_all_qubit_quantum_error(
+        amplitude_damping_error(0.25), 'x')
+    # Pauli X error on the target qubit of "cx"
+    noise_model.add_all_qubit_quantum_error(
+        pauli_error([('XI', 0.1), ('II', 0.9)]), 'cx')
+    # Mixed unitary X error on "y"
+    x_mat = np.array([[0, 1], [1, 0]])
+    noise_model.add_all_qubit_quantum_error(
+        mixed_unitary_error([(x_mat, 0.2), (np.eye(2), 0.8)]), 'y')
+    return [noise_model, noise_model]
+
+
+def fused_gate_error_probabilities():
+    """Fused gate error circuits reference outcome probabilities"""
+    probs_lists = []
+
+    # Qubit 0 is 1 with probability 0.75 after amplitude damping, and
+    # qubit 1 is flipped from qubit 0 with probability
+    # 1 - (0.1 * 0.8 + 0.9 * 0.2) = 0.74
+    probs_lists.append([0.065, 0.555, 0.185, 0.195])
+
+    # Both qubits are 1 with probability 0.75 after amplitude damping, and
+    # qubit 1 differs from qubit 0 with probability
+    # 0.75 * 0.9 + 0.25 * 0.1 = 0.7
+    probs_lists.append([0.075, 0.525, 0.175, 0.225])
+
+    return [list2dict(i, True) for i in probs_lists]
+
+
+def fused_gate_error_counts(shots, hex_counts=True):
+    """Fused gate error circuits reference counts"""
+    counts_lists = []
+    for probs in fused_gate_error_probabilities():
+        counts_lists.append([shots * probs['0x{:x}'.format(i)]
+                             for i in range(4)])
+
+    # Convert to counts dict
+    return [list2dict(i, hex_counts) for i in counts_lists]
@@ -136,3 +136,8 @@ def readout_error_counts(shots, hex_counts=True):
     counts_lists.append(counts)
 
     return [list2dict(i, hex_counts) for i in counts_lists]
+
+
+def readout_error_probabilities(hex_counts=True):
+    """Readout error test circuits reference probabilities."""
+    return readout_error_counts(1, hex_counts)